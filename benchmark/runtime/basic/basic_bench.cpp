@@ -15,6 +15,7 @@
 // This file is a part of scnlib:
 //     https://github.com/eliaskosunen/scnlib
 
+#include <scn/istream.h>
 #include <scn/scan.h>
 #include "benchmark_common.h"
 
@@ -103,6 +104,76 @@ static void bench_basic_scn_value(benchmark::State& state)
 }
 BENCHMARK(bench_basic_scn_value);
 
+template <bool Contiguous>
+struct basic_bench_pair {
+    int a{}, b{};
+};
+
+template <bool Contiguous>
+struct scn::scanner<basic_bench_pair<Contiguous>>
+    : scn::scanner<std::string_view> {
+    template <typename Context>
+    auto scan(basic_bench_pair<Contiguous>& val, Context& ctx) const
+        -> scan_expected<typename Context::iterator>
+    {
+        return scn::scan<int, int>(ctx.range(), "{} {}")
+            .transform([&](auto result) {
+                std::tie(val.a, val.b) = result.values();
+                return result.begin();
+            });
+    }
+};
+
+template <>
+struct scn::scanner_supports_contiguous_context<basic_bench_pair<true>, char>
+    : std::true_type {};
+
+template <bool Contiguous>
+static void bench_basic_scn_custom(benchmark::State& state)
+{
+    std::string_view input{"123 456"};
+    for (auto _ : state) {
+        if (auto result =
+                scn::scan<basic_bench_pair<Contiguous>>(input, "{}")) {
+            benchmark::DoNotOptimize(SCN_MOVE(result->value()));
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK_TEMPLATE(bench_basic_scn_custom, false);
+BENCHMARK_TEMPLATE(bench_basic_scn_custom, true);
+
+struct basic_bench_streamable {
+    int i{};
+
+    friend std::istream& operator>>(std::istream& is,
+                                    basic_bench_streamable& val)
+    {
+        return is >> val.i;
+    }
+};
+
+template <>
+struct scn::scanner<basic_bench_streamable> : scn::istream_scanner {};
+
+static void bench_basic_scn_istream(benchmark::State& state)
+{
+    std::string_view input{"123"};
+    for (auto _ : state) {
+        if (auto result = scn::scan<basic_bench_streamable>(input, "{}")) {
+            benchmark::DoNotOptimize(SCN_MOVE(result->value()));
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_basic_scn_istream);
+
 #if SCN_HAS_INTEGER_CHARCONV
 
 static void bench_basic_from_chars(benchmark::State& state)
@@ -180,4 +251,43 @@ static void bench_basic_sstream(benchmark::State& state)
 }
 BENCHMARK(bench_basic_sstream);
 
+static std::string make_basic_bench_int_list(int64_t n)
+{
+    std::string input{};
+    for (int64_t i = 0; i < n; ++i) {
+        input.append(std::to_string(i * 7919));
+        input.push_back(' ');
+    }
+    return input;
+}
+
+static void bench_basic_scn_istream_source(benchmark::State& state)
+{
+    const auto input = make_basic_bench_int_list(state.range(0));
+    for (auto _ : state) {
+        std::istringstream ss{input};
+        while (auto result = scn::scan<int>(ss, "{}")) {
+            benchmark::DoNotOptimize(result->value());
+        }
+    }
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations() * input.size()));
+}
+BENCHMARK(bench_basic_scn_istream_source)->Arg(1024);
+
+static void bench_basic_sstream_loop(benchmark::State& state)
+{
+    const auto input = make_basic_bench_int_list(state.range(0));
+    for (auto _ : state) {
+        std::istringstream ss{input};
+        int i{};
+        while (ss >> i) {
+            benchmark::DoNotOptimize(i);
+        }
+    }
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations() * input.size()));
+}
+BENCHMARK(bench_basic_sstream_loop)->Arg(1024);
+
 BENCHMARK_MAIN();
@@ -25,6 +25,8 @@
 
 #include <fast_float/fast_float.h>
 
+#include <locale>
+
 template <typename Float>
 static void scan_float_single_scn(benchmark::State& state)
 {
@@ -69,6 +71,32 @@ BENCHMARK_TEMPLATE(scan_float_single_scn_value, float);
 BENCHMARK_TEMPLATE(scan_float_single_scn_value, double);
 BENCHMARK_TEMPLATE(scan_float_single_scn_value, long double);
 
+template <typename Float>
+static void scan_float_single_scn_localized(benchmark::State& state)
+{
+    single_state<Float> s{get_float_list<Float>()};
+    const auto loc = std::locale::classic();
+
+    for (auto _ : state) {
+        s.reset_if_necessary();
+
+        if (auto result = scn::scan<Float>(loc, *s.it, "{:L}"); !result) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            s.push(result->value());
+        }
+    }
+    state.SetBytesProcessed(s.get_bytes_processed(state));
+}
+// Run with multiple threads:
+// localized scanning should not touch any global locale state
+BENCHMARK_TEMPLATE(scan_float_single_scn_localized, float)->ThreadRange(1, 8);
+BENCHMARK_TEMPLATE(scan_float_single_scn_localized, double)->ThreadRange(1, 8);
+BENCHMARK_TEMPLATE(scan_float_single_scn_localized, long double)
+    ->ThreadRange(1, 8);
+
 template <typename Float>
 static void scan_float_single_sstream(benchmark::State& state)
 {
@@ -64,6 +64,15 @@ const std::string& get_integer_string()
     return str;
 }
 
+template <typename Int>
+const std::wstring& get_integer_wstring()
+{
+    // Only ASCII, so widening every code unit is enough
+    static auto str = std::wstring(get_integer_string<Int>().begin(),
+                                   get_integer_string<Int>().end());
+    return str;
+}
+
 inline int sscanf_integral(const char* ptr, int& i)
 {
     return std::sscanf(ptr, "%d", &i);
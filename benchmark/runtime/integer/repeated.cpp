@@ -19,6 +19,8 @@
 
 #include "int_bench.h"
 
+#include <scn/xchar.h>
+
 #if SCN_HAS_INTEGER_CHARCONV
 #include <charconv>
 #endif
@@ -81,6 +83,36 @@ BENCHMARK_TEMPLATE(scan_int_repeated_scn_value, int);
 BENCHMARK_TEMPLATE(scan_int_repeated_scn_value, long long);
 BENCHMARK_TEMPLATE(scan_int_repeated_scn_value, unsigned);
 
+template <typename Int>
+static void scan_int_repeated_scn_wide(benchmark::State& state)
+{
+    const auto& source = get_integer_wstring<Int>();
+    auto subr = scn::ranges::subrange{source};
+
+    for (auto _ : state) {
+        auto result = scn::scan<Int>(subr, L"{}");
+
+        if (!result) {
+            if (result.error() == scn::scan_error::end_of_range) {
+                subr = scn::ranges::subrange{source};
+            }
+            else {
+                state.SkipWithError("Scan error");
+                break;
+            }
+        }
+        else {
+            benchmark::DoNotOptimize(result->value());
+            subr = result->range();
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(sizeof(Int)));
+}
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_wide, int);
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_wide, long long);
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_wide, unsigned);
+
 template <typename Int>
 static void scan_int_repeated_scn_decimal(benchmark::State& state)
 {
@@ -169,6 +201,34 @@ BENCHMARK_TEMPLATE(scan_int_repeated_sstream, int);
 BENCHMARK_TEMPLATE(scan_int_repeated_sstream, long long);
 BENCHMARK_TEMPLATE(scan_int_repeated_sstream, unsigned);
 
+template <typename Int>
+static void scan_int_repeated_wsstream(benchmark::State& state)
+{
+    const auto& source = get_integer_wstring<Int>();
+    std::wistringstream stream{source};
+
+    for (auto _ : state) {
+        Int i{};
+        stream >> i;
+
+        if (stream.eof()) {
+            stream = std::wistringstream(source);
+        }
+        else if (stream.fail()) {
+            state.SkipWithError("Scan error");
+            break;
+        }
+        else {
+            benchmark::DoNotOptimize(i);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(sizeof(Int)));
+}
+BENCHMARK_TEMPLATE(scan_int_repeated_wsstream, int);
+BENCHMARK_TEMPLATE(scan_int_repeated_wsstream, long long);
+BENCHMARK_TEMPLATE(scan_int_repeated_wsstream, unsigned);
+
 template <typename Int>
 static void scan_int_repeated_scanf(benchmark::State& state)
 {
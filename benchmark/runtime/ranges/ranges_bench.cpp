@@ -0,0 +1,128 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+#include <scn/ranges.h>
+#include <scn/scan.h>
+#include "benchmark_common.h"
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+template <typename T>
+static std::string make_ranges_bench_input(int64_t n)
+{
+    std::string input{"["};
+    for (int64_t i = 0; i < n; ++i) {
+        if (i != 0) {
+            input.append(", ");
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            input.append(std::to_string(static_cast<double>(i) * 0.25));
+        }
+        else {
+            input.append(std::to_string(i * 7919));
+        }
+    }
+    input.push_back(']');
+    return input;
+}
+
+template <typename T>
+static void bench_ranges_vector_scn(benchmark::State& state)
+{
+    const auto input = make_ranges_bench_input<T>(state.range(0));
+    for (auto _ : state) {
+        if (auto result = scn::scan<std::vector<T>>(input, "{}")) {
+            benchmark::DoNotOptimize(result->value().data());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations() * input.size()));
+}
+BENCHMARK_TEMPLATE(bench_ranges_vector_scn, int)->Arg(16)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(bench_ranges_vector_scn, double)->Arg(16)->Arg(1 << 20);
+
+// Baseline: the same values, scanned one at a time, without brackets
+template <typename T>
+static void bench_ranges_values_scn(benchmark::State& state)
+{
+    auto input = make_ranges_bench_input<T>(state.range(0));
+    input = input.substr(1, input.size() - 2);
+    const auto input_end = input.data() + input.size();
+    for (auto _ : state) {
+        std::vector<T> values{};
+        std::string_view rest{input};
+        while (auto result = scn::scan<T>(rest, "{}")) {
+            values.push_back(result->value());
+            const auto rest_begin =
+                scn::detail::to_address(result->range().begin());
+            rest = std::string_view{
+                rest_begin, static_cast<std::size_t>(input_end - rest_begin)};
+            if (rest.empty() || rest.front() != ',') {
+                break;
+            }
+            rest.remove_prefix(1);
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations() * input.size()));
+}
+BENCHMARK_TEMPLATE(bench_ranges_values_scn, int)->Arg(16)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(bench_ranges_values_scn, double)->Arg(16)->Arg(1 << 20);
+
+static std::string make_ranges_bench_map_input(int64_t n)
+{
+    std::string input{"{"};
+    for (int64_t i = 0; i < n; ++i) {
+        if (i != 0) {
+            input.append(", ");
+        }
+        input.append(std::to_string(i));
+        input.append(": ");
+        input.append(std::to_string(i * 7919));
+    }
+    input.push_back('}');
+    return input;
+}
+
+template <typename Map>
+static void bench_ranges_map_scn(benchmark::State& state)
+{
+    const auto input = make_ranges_bench_map_input(state.range(0));
+    for (auto _ : state) {
+        if (auto result = scn::scan<Map>(input, "{}")) {
+            benchmark::DoNotOptimize(result->value().size());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations() * input.size()));
+}
+BENCHMARK_TEMPLATE(bench_ranges_map_scn, std::map<int, int>)
+    ->Arg(16)
+    ->Arg(100'000);
+BENCHMARK_TEMPLATE(bench_ranges_map_scn, std::unordered_map<int, int>)
+    ->Arg(16)
+    ->Arg(100'000);
@@ -0,0 +1,141 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include <scn/regex.h>
+#include <scn/scan.h>
+#include "benchmark_common.h"
+
+#include <regex>
+
+#if !SCN_DISABLE_REGEX
+
+static constexpr std::string_view regex_bench_input{"abc-123 def"};
+
+static void bench_regex_string_view_scn(benchmark::State& state)
+{
+    for (auto _ : state) {
+        if (auto result = scn::scan<std::string_view>(regex_bench_input,
+                                                      "{:/[a-z]+-[0-9]+/}")) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_regex_string_view_scn);
+
+static void bench_regex_string_scn(benchmark::State& state)
+{
+    for (auto _ : state) {
+        if (auto result = scn::scan<std::string>(regex_bench_input,
+                                                 "{:/[a-z]+-[0-9]+/}")) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_regex_string_scn);
+
+static void bench_regex_matches_scn(benchmark::State& state)
+{
+    for (auto _ : state) {
+        if (auto result = scn::scan<scn::regex_matches>(
+                regex_bench_input, "{:/([a-z]+)-([0-9]+)/}")) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_regex_matches_scn);
+
+// Cycles through state.range(0) different patterns:
+// once there are more of them than fit in the compiled regex cache,
+// every scan has to compile its regex
+static void bench_regex_distinct_patterns_scn(benchmark::State& state)
+{
+    std::vector<std::string> patterns{};
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        patterns.push_back("{:/[a-z]{1," + std::to_string(3 + i) + "}/}");
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state) {
+        if (auto result = scn::scan<std::string_view>(
+                regex_bench_input, scn::runtime_format(patterns[i]))) {
+            benchmark::DoNotOptimize(result->value());
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+        i = (i + 1) % patterns.size();
+    }
+}
+BENCHMARK(bench_regex_distinct_patterns_scn)
+    ->Arg(1)
+    ->Arg(SCN_REGEX_CACHE_SIZE)
+    ->Arg(SCN_REGEX_CACHE_SIZE * 2);
+
+static void bench_regex_std_compile_every_time(benchmark::State& state)
+{
+    for (auto _ : state) {
+        std::regex re{"[a-z]+-[0-9]+", std::regex_constants::nosubs};
+        std::cmatch matches{};
+        if (std::regex_search(regex_bench_input.data(),
+                              regex_bench_input.data() +
+                                  regex_bench_input.size(),
+                              matches, re,
+                              std::regex_constants::match_continuous)) {
+            benchmark::DoNotOptimize(matches[0].second);
+        }
+        else {
+            state.SkipWithError("Failed match");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_regex_std_compile_every_time);
+
+static void bench_regex_std_precompiled(benchmark::State& state)
+{
+    const std::regex re{"[a-z]+-[0-9]+", std::regex_constants::nosubs};
+    for (auto _ : state) {
+        std::cmatch matches{};
+        if (std::regex_search(regex_bench_input.data(),
+                              regex_bench_input.data() +
+                                  regex_bench_input.size(),
+                              matches, re,
+                              std::regex_constants::match_continuous)) {
+            benchmark::DoNotOptimize(matches[0].second);
+        }
+        else {
+            state.SkipWithError("Failed match");
+            break;
+        }
+    }
+}
+BENCHMARK(bench_regex_std_precompiled);
+
+#endif  // !SCN_DISABLE_REGEX
@@ -65,6 +65,62 @@ BENCHMARK(bench_string_scn<wchar_t, std::wstring, unicode_tag>);
 BENCHMARK(bench_string_scn<wchar_t, std::wstring_view, lipsum_tag>);
 BENCHMARK(bench_string_scn<wchar_t, std::wstring_view, unicode_tag>);
 
+template <typename DestStringT, typename Tag>
+static void bench_string_scn_assume_valid(benchmark::State& state)
+{
+    auto input = get_benchmark_input<char, Tag>();
+    auto subr = scn::ranges::subrange{input};
+    for (auto _ : state) {
+        if (auto result = scn::scan<DestStringT>(scn::assume_valid_utf8, subr,
+                                                 bench_format_string<char>())) {
+            benchmark::DoNotOptimize(result->value());
+            subr = result->range();
+        }
+        else if (result.error() == scn::scan_error::end_of_range) {
+            subr = scn::ranges::subrange{input};
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+
+BENCHMARK(bench_string_scn_assume_valid<std::string_view, lipsum_tag>);
+BENCHMARK(bench_string_scn_assume_valid<std::string_view, unicode_tag>);
+BENCHMARK(bench_string_scn_assume_valid<std::string, lipsum_tag>);
+BENCHMARK(bench_string_scn_assume_valid<std::string, unicode_tag>);
+BENCHMARK(bench_string_scn_assume_valid<std::wstring, lipsum_tag>);
+BENCHMARK(bench_string_scn_assume_valid<std::wstring, unicode_tag>);
+
+// Scans the whole input one word at a time, so that the ASCII check
+// of every call only covers what that call reads
+template <typename DestStringT, typename Tag>
+static void bench_string_scn_ascii_source(benchmark::State& state)
+{
+    auto input = get_benchmark_input<char, Tag>();
+    auto subr = scn::ranges::subrange{input};
+    for (auto _ : state) {
+        if (auto result = scn::scan<DestStringT>(scn::ascii_source, subr,
+                                                 bench_format_string<char>())) {
+            benchmark::DoNotOptimize(result->value());
+            subr = result->range();
+        }
+        else if (result.error() == scn::scan_error::end_of_range) {
+            subr = scn::ranges::subrange{input};
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+
+BENCHMARK(bench_string_scn_ascii_source<std::string_view, lipsum_tag>);
+BENCHMARK(bench_string_scn_ascii_source<std::string_view, unicode_tag>);
+BENCHMARK(bench_string_scn_ascii_source<std::string, lipsum_tag>);
+BENCHMARK(bench_string_scn_ascii_source<std::wstring, lipsum_tag>);
+
 template <typename SourceCharT, typename DestStringT, typename Tag>
 static void bench_string_scn_value(benchmark::State& state)
 {
@@ -98,6 +154,42 @@ BENCHMARK(bench_string_scn_value<wchar_t, std::wstring, unicode_tag>);
 BENCHMARK(bench_string_scn_value<wchar_t, std::wstring_view, lipsum_tag>);
 BENCHMARK(bench_string_scn_value<wchar_t, std::wstring_view, unicode_tag>);
 
+// Words separated by long runs of whitespace,
+// dominated by skipping the whitespace before every word
+template <typename CharT>
+static void bench_string_scn_spaced_words(benchmark::State& state)
+{
+    const auto words = get_benchmark_input<CharT, lipsum_tag>();
+    std::basic_string<CharT> input{};
+    for (auto ch : words) {
+        if (ch == CharT{' '}) {
+            input.append(32, CharT{' '});
+        }
+        else {
+            input.push_back(ch);
+        }
+    }
+
+    auto subr = scn::ranges::subrange{input};
+    for (auto _ : state) {
+        if (auto result = scn::scan<std::basic_string_view<CharT>>(
+                subr, bench_format_string<CharT>())) {
+            benchmark::DoNotOptimize(result->value());
+            subr = result->range();
+        }
+        else if (result.error() == scn::scan_error::end_of_range) {
+            subr = scn::ranges::subrange{input};
+        }
+        else {
+            state.SkipWithError("Failed scan");
+            break;
+        }
+    }
+}
+
+BENCHMARK(bench_string_scn_spaced_words<char>);
+BENCHMARK(bench_string_scn_spaced_words<wchar_t>);
+
 template <typename CharT, typename Tag>
 static void bench_string_sstream(benchmark::State& state)
 {
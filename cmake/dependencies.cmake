@@ -158,6 +158,14 @@ if (SCN_REGEX_BACKEND STREQUAL "re2")
     set(SCN_REGEX_BACKEND_TARGET re2::re2)
 endif ()
 
+# Threads, for the compiled regex cache
+
+if (UNIX AND NOT SCN_DISABLE_REGEX)
+    set(THREADS_PREFER_PTHREAD_FLAG ON)
+    find_package(Threads REQUIRED)
+    list(APPEND SCN_REGEX_BACKEND_TARGET Threads::Threads)
+endif ()
+
 # make available
 
 FetchContent_MakeAvailable(
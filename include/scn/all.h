@@ -19,6 +19,7 @@
 
 #include <scn/scan.h>
 
+#include <scn/fixed_decimal.h>
 #include <scn/istream.h>
 #include <scn/ranges.h>
 #include <scn/regex.h>
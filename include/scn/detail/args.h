@@ -117,7 +117,8 @@ SCN_TYPE_CONSTANT(wregex_matches, wide_regex_matches_type, SCN_DISABLE_REGEX);
 
 struct custom_value_type {
     void* value;
-    scan_error (*scan)(void* arg, void* pctx, void* ctx);
+    // `ctx` points to a `basic_contiguous_scan_context` if `is_contiguous`
+    scan_error (*scan)(void* arg, void* pctx, void* ctx, bool is_contiguous);
 };
 
 struct unscannable {};
@@ -178,7 +179,10 @@ public:
 
 private:
     template <typename T, typename Context>
-    static scan_error scan_custom_arg(void* arg, void* pctx, void* ctx)
+    static scan_error scan_custom_arg(void* arg,
+                                      void* pctx,
+                                      void* ctx,
+                                      bool is_contiguous)
     {
         static_assert(!is_type_disabled<T>,
                       "Scanning of custom types is disabled by "
@@ -186,6 +190,7 @@ private:
         SCN_EXPECT(arg && pctx && ctx);
 
         using context_type = Context;
+        using char_type = typename context_type::char_type;
         using parse_context_type = typename context_type::parse_context_type;
         using scanner_type = typename context_type::template scanner_type<T>;
 
@@ -193,10 +198,34 @@ private:
 
         auto& arg_ref = *static_cast<T*>(arg);
         auto& pctx_ref = *static_cast<parse_context_type*>(pctx);
-        auto& ctx_ref = *static_cast<context_type*>(ctx);
 
         SCN_TRY_ERR(_, s.parse(pctx_ref));
         SCN_UNUSED(_);
+
+        if (is_contiguous) {
+            auto& ctx_ref =
+                *static_cast<basic_contiguous_scan_context<char_type>*>(ctx);
+            if constexpr (scanner_supports_contiguous_context<T, char_type>{}) {
+                SCN_TRY_ERR(it, s.scan(arg_ref, ctx_ref));
+                ctx_ref.advance_to(SCN_MOVE(it));
+            }
+            else {
+                // Scan through a non-contiguous context over the rest of
+                // the source, positioned at 0
+                const auto rest = ctx_ref.range();
+                auto custom_ctx = context_type{
+                    typename context_type::iterator{
+                        std::basic_string_view<char_type>(rest.data(),
+                                                          rest.size()),
+                        0},
+                    ctx_ref.args(), ctx_ref.locale()};
+                SCN_TRY_ERR(it, s.scan(arg_ref, custom_ctx));
+                ctx_ref.advance_to(ctx_ref.begin() + it.position());
+            }
+            return {};
+        }
+
+        auto& ctx_ref = *static_cast<context_type*>(ctx);
         SCN_TRY_ERR(it, s.scan(arg_ref, ctx_ref));
         ctx_ref.advance_to(SCN_MOVE(it));
 
@@ -459,7 +488,25 @@ public:
         scan_error scan(typename Context::parse_context_type& parse_ctx,
                         Context& ctx) const
         {
-            return m_custom.scan(m_custom.value, &parse_ctx, &ctx);
+            return m_custom.scan(m_custom.value, &parse_ctx, &ctx, false);
+        }
+
+        /**
+         * Parse the format string in `parse_ctx`, and scan the value from
+         * the contiguous context `ctx`.
+         *
+         * Unless the scanner opts in through
+         * `scanner_supports_contiguous_context`, it's given
+         * a `basic_scan_context` over the rest of `ctx` instead.
+         *
+         * \return Any error returned by the scanner
+         */
+        scan_error scan(
+            typename Context::parse_context_type& parse_ctx,
+            basic_contiguous_scan_context<typename Context::char_type>& ctx)
+            const
+        {
+            return m_custom.scan(m_custom.value, &parse_ctx, &ctx, true);
         }
 
     private:
@@ -73,6 +73,11 @@
 // TODO: PCRE (Perl Compatible Regular Expressions)
 // #define SCN_REGEX_BACKEND_PCRE  3
 // TODO: CTRE (Compile-Time Regular Expressions)
+// Needs the pattern as a template argument, but format specs (including
+// regex patterns) only reach the type-erased vscan as runtime strings,
+// even when the format string is checked at compile time.
+// Until that changes, compiled regexes are cached instead
+// (see SCN_REGEX_CACHE_SIZE).
 // #define SCN_REGEX_BACKEND_CTRE  4
 
 // Default to std::regex
@@ -107,6 +112,22 @@
 #define SCN_REGEX_SUPPORTS_UTF8_CLASSIFICATION 0
 #endif
 
+// Boost.Regex can match over bidirectional iterators without looking
+// at the end of the input up front, which allows matching regexes
+// against non-contiguous sources. Its ICU wrapper needs the end.
+#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_BOOST && !SCN_REGEX_BOOST_USE_ICU
+#define SCN_REGEX_SUPPORTS_NON_CONTIGUOUS_SOURCES 1
+#else
+#define SCN_REGEX_SUPPORTS_NON_CONTIGUOUS_SOURCES 0
+#endif
+
+// SCN_REGEX_CACHE_SIZE
+// Number of compiled regular expressions the library keeps cached,
+// keyed by pattern and flags. If 0, every regex is compiled on every use.
+#ifndef SCN_REGEX_CACHE_SIZE
+#define SCN_REGEX_CACHE_SIZE 32
+#endif
+
 // SCN_DISABLE_IOSTREAM
 // If 1, removes all references and functionality related to standard streams.
 #ifndef SCN_DISABLE_IOSTREAM
@@ -150,5 +150,120 @@ private:
     iterator m_current;
 };
 
+/**
+ * Scanning context over a contiguous source range.
+ *
+ * Used instead of `basic_scan_context` when the source range is contiguous,
+ * and iterated with plain pointers.
+ * `scanner<T>::scan` is only called with it, if `T` has opted in through
+ * `scanner_supports_contiguous_context`.
+ *
+ * \ingroup ctx
+ */
+template <typename CharT>
+class basic_contiguous_scan_context
+    : public detail::
+          scan_context_base<CharT, basic_scan_args<basic_scan_context<CharT>>> {
+    using base =
+        detail::scan_context_base<CharT,
+                                  basic_scan_args<basic_scan_context<CharT>>>;
+
+public:
+    /// Character type of the input
+    using char_type = CharT;
+    using buffer_type = detail::basic_scan_buffer<char_type>;
+    using range_type = ranges::subrange<const char_type*, const char_type*>;
+    using iterator = const char_type*;
+    using sentinel = const char_type*;
+    using parse_context_type = basic_scan_parse_context<char_type>;
+
+    /// Non-contiguous context, with which the arguments are shared
+    using parent_context_type = basic_scan_context<char_type>;
+    using args_type = basic_scan_args<parent_context_type>;
+    using arg_type = basic_scan_arg<parent_context_type>;
+
+    /**
+     * The scanner type associated with this scanning context.
+     */
+    template <typename T>
+    using scanner_type = scanner<T, char_type>;
+
+    template <typename Range,
+              std::enable_if_t<ranges::contiguous_range<Range> &&
+                               ranges::borrowed_range<Range>>* = nullptr>
+    constexpr basic_contiguous_scan_context(Range&& r,
+                                            args_type a,
+                                            detail::locale_ref loc = {})
+        : base(SCN_MOVE(a), loc),
+          m_range(SCN_FWD(r)),
+          m_current(m_range.begin())
+    {
+    }
+
+    /**
+     * Returns a pointer to the current position in the source range.
+     */
+    constexpr iterator begin() const
+    {
+        return m_current;
+    }
+
+    /**
+     * Returns a pointer to the end of the source range.
+     */
+    constexpr sentinel end() const
+    {
+        return m_range.end();
+    }
+
+    /**
+     * Returns a subrange over `[begin(), end())`
+     */
+    constexpr auto range() const
+    {
+        return ranges::subrange{begin(), end()};
+    }
+
+    /**
+     * Returns the entire source range, including the already scanned part.
+     */
+    constexpr auto underlying_range() const
+    {
+        return m_range;
+    }
+
+    /// Advances the beginning of the source range to `it`
+    void advance_to(iterator it)
+    {
+        SCN_EXPECT(it <= end());
+        if constexpr (detail::is_comparable_with_nullptr<iterator>::value) {
+            if (it == nullptr) {
+                it = end();
+            }
+        }
+        m_current = SCN_MOVE(it);
+    }
+
+    /**
+     * Advances the beginning of the source range to `it`,
+     * an iterator of a `parent_context_type` over `underlying_range()`.
+     */
+    void advance_to(const typename parent_context_type::iterator& it)
+    {
+        SCN_EXPECT(it.position() <= m_range.size());
+        m_current = m_range.begin() + it.position();
+    }
+
+    /// Returns the distance from the beginning of `underlying_range()`
+    std::ptrdiff_t begin_position()
+    {
+        return ranges::distance(m_range.begin(), begin());
+    }
+
+private:
+    range_type m_range;
+    iterator m_current;
+};
+
 SCN_END_NAMESPACE
 }  // namespace scn
@@ -0,0 +1,194 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#pragma once
+
+#include <scn/detail/context.h>
+#include <scn/detail/scanner.h>
+
+#include <cstdint>
+#include <limits>
+
+namespace scn {
+SCN_BEGIN_NAMESPACE
+
+/**
+ * How to handle fractional digits beyond the scale of a `fixed_decimal`.
+ *
+ * \ingroup format-string
+ */
+enum class fixed_decimal_rounding {
+    /// Discard the extra digits: "1.239" with scale 2 -> 123
+    toward_zero,
+    /// Round half to even: "1.225" -> 122, "1.235" -> 124
+    to_nearest_even,
+    /// Round half away from zero: "1.225" -> 123, "-1.225" -> -123
+    to_nearest_away_from_zero,
+};
+
+/**
+ * Decimal number with `Scale` fractional digits, stored as a scaled integer.
+ *
+ * Scanning a `fixed_decimal<std::int64_t, 6>` from "12345.678901" produces
+ * `value == 12345678901`. No floating-point conversion takes place,
+ * so the result is exact, up to the rounding of fractional digits beyond
+ * `Scale`, controlled by `Rounding`.
+ *
+ * Accepted input is an optional sign, followed by decimal digits,
+ * optionally followed by a `.` and more decimal digits.
+ * At least one digit is required.
+ * Values not fitting in `Int` after scaling
+ * are reported with `scan_error::value_out_of_range`.
+ *
+ * Only the default format specification `{}` is supported.
+ *
+ * \code{.cpp}
+ * #include <scn/fixed_decimal.h>
+ *
+ * auto result = scn::scan<scn::fixed_decimal<std::int64_t, 2>>("-12.34", "{}");
+ * // result->value().value == -1234
+ * \endcode
+ *
+ * \ingroup format-string
+ */
+template <typename Int,
+          unsigned Scale,
+          fixed_decimal_rounding Rounding =
+              fixed_decimal_rounding::to_nearest_even>
+struct fixed_decimal {
+    static_assert(std::is_integral_v<Int> && !std::is_same_v<Int, bool>);
+    static_assert(Scale <= 19, "Scale too large for a 64-bit value");
+
+    using value_type = Int;
+    static constexpr unsigned scale = Scale;
+    static constexpr fixed_decimal_rounding rounding = Rounding;
+
+    Int value{};
+};
+
+namespace detail {
+/**
+ * Scans the unsigned, scaled magnitude of a fixed-point decimal number.
+ * Out-of-range is reported only when the magnitude doesn't fit in 64 bits,
+ * it's up to the caller to check it against the actual value type.
+ */
+template <typename Context>
+scan_expected<typename Context::iterator> scan_fixed_decimal_magnitude(
+    Context& ctx,
+    unsigned scale,
+    fixed_decimal_rounding rounding,
+    std::uint64_t& magnitude,
+    bool& is_negative);
+
+extern template scan_expected<scan_context::iterator>
+scan_fixed_decimal_magnitude(scan_context&,
+                             unsigned,
+                             fixed_decimal_rounding,
+                             std::uint64_t&,
+                             bool&);
+extern template scan_expected<wscan_context::iterator>
+scan_fixed_decimal_magnitude(wscan_context&,
+                             unsigned,
+                             fixed_decimal_rounding,
+                             std::uint64_t&,
+                             bool&);
+
+template <typename Int>
+constexpr scan_error store_fixed_decimal_magnitude(std::uint64_t magnitude,
+                                                   bool is_negative,
+                                                   Int& value)
+{
+    using uint_type = std::make_unsigned_t<Int>;
+    constexpr auto max = static_cast<std::uint64_t>(
+        static_cast<uint_type>(std::numeric_limits<Int>::max()));
+
+    if (!is_negative) {
+        if (SCN_UNLIKELY(magnitude > max)) {
+            return {scan_error::value_out_of_range,
+                    "Scanned fixed_decimal out of range"};
+        }
+        value = static_cast<Int>(magnitude);
+        return {};
+    }
+
+    if constexpr (std::is_signed_v<Int>) {
+        if (SCN_UNLIKELY(magnitude > max + 1)) {
+            return {scan_error::value_out_of_range,
+                    "Scanned fixed_decimal out of range"};
+        }
+        // Negate in the unsigned domain to avoid overflowing on min()
+        value = static_cast<Int>(
+            static_cast<uint_type>(0) -
+            static_cast<uint_type>(magnitude));
+        return {};
+    }
+    else {
+        if (magnitude == 0) {
+            value = 0;
+            return {};
+        }
+        return {scan_error::invalid_scanned_value,
+                "Unexpected '-' sign when parsing an unsigned value"};
+    }
+}
+}  // namespace detail
+
+template <typename Int,
+          unsigned Scale,
+          fixed_decimal_rounding Rounding,
+          typename CharT>
+struct scanner<fixed_decimal<Int, Scale, Rounding>, CharT> {
+    template <typename ParseCtx>
+    constexpr auto parse(ParseCtx& pctx)
+        -> scan_expected<typename ParseCtx::iterator>
+    {
+        if (pctx.begin() != pctx.end() && *pctx.begin() != CharT{'}'}) {
+            return unexpected_scan_error(
+                scan_error::invalid_format_string,
+                "Unsupported format specifier for fixed_decimal");
+        }
+        return pctx.begin();
+    }
+
+    template <typename Context>
+    scan_expected<typename Context::iterator> scan(
+        fixed_decimal<Int, Scale, Rounding>& val,
+        Context& ctx) const
+    {
+        std::uint64_t magnitude{};
+        bool is_negative{false};
+        SCN_TRY(it, detail::scan_fixed_decimal_magnitude(
+                        ctx, Scale, Rounding, magnitude, is_negative));
+        if (auto e = detail::store_fixed_decimal_magnitude(
+                magnitude, is_negative, val.value);
+            SCN_UNLIKELY(!e)) {
+            return unexpected(e);
+        }
+        return it;
+    }
+};
+
+template <typename Int,
+          unsigned Scale,
+          fixed_decimal_rounding Rounding,
+          typename CharT>
+struct scanner_supports_contiguous_context<
+    fixed_decimal<Int, Scale, Rounding>,
+    CharT> : std::true_type {};
+
+SCN_END_NAMESPACE
+}  // namespace scn
@@ -420,7 +420,8 @@ constexpr typename ParseCtx::iterator parse_format_specs(ParseCtx& parse_ctx)
                       return err;
                   })
                   .value_or(parse_ctx.end());
-    if constexpr (scanner_has_format_specs_member_v<decltype(s)>) {
+    if constexpr (!SCN_REGEX_SUPPORTS_NON_CONTIGUOUS_SOURCES &&
+                  scanner_has_format_specs_member_v<decltype(s)>) {
         auto& specs = s._format_specs();
         if ((specs.type == presentation_type::regex ||
              specs.type == presentation_type::regex_escaped) &&
@@ -22,6 +22,7 @@
 #include <scn/detail/unicode.h>
 
 #include <limits>
+#include <utility>
 
 namespace scn {
 SCN_BEGIN_NAMESPACE
@@ -184,6 +185,10 @@ struct format_specs {
     bool charset_has_nonascii{false}, charset_is_inverted{false};
     const void* charset_string_data{nullptr};
     size_t charset_string_size{0};
+    // Sorted and merged non-ASCII ranges of a character set,
+    // if they've been compiled ahead of reading; `nullptr` otherwise
+    const std::pair<char32_t, char32_t>* charset_nonascii_ranges{nullptr};
+    size_t charset_nonascii_ranges_size{0};
     regex_flags regexp_flags{regex_flags::none};
     unsigned char arbitrary_base{0};
     align_type align{align_type::none};
@@ -43,15 +43,18 @@ SCN_BEGIN_NAMESPACE
  *     std::same_as<ranges::range_value_t<Range>, CharT>;
  * \endcode
  *
- * Additionally, files (`std::FILE*`) can be scanned from.
- * Files are always considered to be narrow (`char`-oriented).
+ * Additionally, files (`std::FILE*`) and input streams (lvalues of
+ * `std::istream`, or of types derived from it) can be scanned from.
+ * Both are always considered to be narrow (`char`-oriented).
  * Thus, the entire concept is:
  *
  * \code{.cpp}
  * // Exposition only
  * template <typename Source, typename CharT>
  * concept scannable_source =
- *   (std::same_as<std::remove_cvref_t<Source>, std::FILE*> &&
+ *   ((std::same_as<std::remove_cvref_t<Source>, std::FILE*> ||
+ *     (std::is_lvalue_reference_v<Source> &&
+ *      std::derived_from<std::remove_cvref_t<Source>, std::istream>)) &&
  *    std::same_as<CharT, char>) ||
  *   scannable_range<Source, CharT>;
  * \endcode
@@ -144,6 +147,16 @@ inline auto impl(std::FILE* file, priority_tag<3>)
     return make_file_scan_buffer(file);
 }
 
+#if !SCN_DISABLE_IOSTREAM
+// istream& -> istream_buffer
+template <typename Stream,
+          std::enable_if_t<std::is_base_of_v<std::istream, Stream>>* = nullptr>
+auto impl(const Stream& stream, priority_tag<3>)
+{
+    return make_istream_scan_buffer(stream);
+}
+#endif
+
 // contiguous + sized -> string_buffer
 template <typename Range,
           std::enable_if_t<ranges::contiguous_range<Range> &&
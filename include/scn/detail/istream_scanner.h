@@ -62,6 +62,11 @@ struct is_streamable
 /**
  * Wraps `SourceRange`, and makes it a `std::basic_streambuf`.
  *
+ * The get area of the streambuf is set directly over the source:
+ * the entire rest of it, if it's contiguous,
+ * or the current segment of the underlying `basic_scan_buffer`, if not.
+ * The source is advanced to the next segment on `underflow`.
+ *
  * Used by `basic_istream_scanner`.
  */
 template <typename SourceRange>
@@ -77,76 +82,92 @@ public:
     using int_type = typename base::int_type;
 
     explicit basic_range_streambuf(range_type range)
-        : m_range(range), m_begin(ranges::begin(m_range)), m_begin_prev(m_begin)
+        : m_range(range), m_segment_begin(ranges::begin(m_range))
     {
+        set_segment();
     }
 
+    /// Returns an iterator pointing to the next character not yet read
     iterator begin() const
-        SCN_NOEXCEPT_P(std::is_nothrow_copy_constructible_v<iterator>)
-    {
-        return m_begin;
-    }
-    iterator begin_prev() const
-        SCN_NOEXCEPT_P(std::is_nothrow_copy_constructible_v<iterator>)
     {
-        return m_begin_prev;
-    }
-    int_type last_char() const SCN_NOEXCEPT
-    {
-        return m_ch;
+        const auto consumed = this->gptr() - this->eback();
+        if constexpr (std::is_pointer_v<iterator>) {
+            return m_segment_begin + consumed;
+        }
+        else {
+            auto it = m_segment_begin;
+            it.batch_advance(consumed);
+            return it;
+        }
     }
 
 private:
-    int_type underflow() override
+    void set_segment()
     {
-        // Already read
-        if (!traits_type::eq_int_type(m_ch, traits_type::eof())) {
-            return m_ch;
+        auto segment = std::basic_string_view<char_type>{};
+        if constexpr (std::is_pointer_v<iterator>) {
+            segment = make_string_view_from_pointers(m_segment_begin,
+                                                     ranges::end(m_range));
         }
-
-        if (m_begin == ranges::end(m_range)) {
-            return traits_type::eof();
+        else {
+            if (m_segment_begin != ranges::end(m_range)) {
+                segment = m_segment_begin.contiguous_segment();
+            }
         }
-        m_begin_prev = m_begin;
-        SCN_CLANG_PUSH_IGNORE_UNSAFE_BUFFER_USAGE
-        m_ch = traits_type::to_int_type(*m_begin++);
-        SCN_CLANG_POP_IGNORE_UNSAFE_BUFFER_USAGE
-        return m_ch;
-    }
 
-    int_type uflow() override
-    {
-        auto ret = underflow();
-        if (ret != traits_type::eof()) {
-            m_ch = traits_type::eof();
-        }
-        return ret;
+        auto ptr = const_cast<char_type*>(segment.data());
+        this->setg(ptr, ptr, ptr + segment.size());
     }
 
-    std::streamsize showmanyc() override
+    int_type underflow() override
     {
-        return traits_type::eq_int_type(m_ch, traits_type::eof()) ? 0 : 1;
+        if constexpr (!std::is_pointer_v<iterator>) {
+            m_segment_begin = begin();
+            set_segment();
+            if (this->gptr() != this->egptr()) {
+                return traits_type::to_int_type(*this->gptr());
+            }
+        }
+        return traits_type::eof();
     }
 
     int_type pbackfail(int_type c) override
     {
-        SCN_EXPECT(traits_type::eq_int_type(c, traits_type::eof()));
-        SCN_EXPECT(!m_has_put_back);
-        m_has_put_back = true;
+        // Putting back a different character than the one read
+        // would require modifying the source
+        if (this->gptr() != this->eback()) {
+            return traits_type::eof();
+        }
 
-        m_begin = m_begin_prev;
+        if constexpr (!std::is_pointer_v<iterator>) {
+            const auto range_begin = ranges::begin(m_range);
+            if (m_segment_begin.position() == range_begin.position()) {
+                return traits_type::eof();
+            }
 
-        if (m_begin == ranges::end(m_range)) {
+            // Move to the segment containing the previous character,
+            // which is kept around by the scan buffer
+            auto it = range_begin;
+            it.batch_advance_to(m_segment_begin.position() - 1);
+            m_segment_begin = it;
+            set_segment();
+
+            if (!traits_type::eq_int_type(c, traits_type::eof()) &&
+                !traits_type::eq(traits_type::to_char_type(c),
+                                 *this->gptr())) {
+                this->gbump(1);
+                return traits_type::eof();
+            }
+            return traits_type::not_eof(c);
+        }
+        else {
+            SCN_UNUSED(c);
             return traits_type::eof();
         }
-        return traits_type::to_int_type(0);
     }
 
     range_type m_range;
-    iterator m_begin;
-    iterator m_begin_prev;
-    int_type m_ch{traits_type::eof()};
-    bool m_has_put_back{false};
+    iterator m_segment_begin;
 };
 
 using range_streambuf = basic_range_streambuf<scan_context::range_type>;
@@ -172,6 +193,10 @@ using wrange_streambuf = basic_range_streambuf<wscan_context::range_type>;
  *
  * auto [result, myvalue] = scn::scan<mytype>(...);
  * \endcode
+ *
+ * The stream reads directly from the source range, without copying it.
+ * To also skip building a `basic_scan_context` for contiguous sources,
+ * specialize `scn::scanner_supports_contiguous_context` for `mytype`.
  */
 template <typename CharT>
 struct basic_istream_scanner {
@@ -186,7 +211,6 @@ struct basic_istream_scanner {
     {
         detail::basic_range_streambuf<typename Context::range_type> streambuf(
             ctx.range());
-        using traits = typename decltype(streambuf)::traits_type;
         std::basic_istream<CharT> stream(std::addressof(streambuf));
 
         if (!(stream >> val)) {
@@ -203,10 +227,7 @@ struct basic_istream_scanner {
                                          "Failed to read with std::istream");
         }
 
-        if (traits::eq_int_type(streambuf.last_char(), traits::eof())) {
-            return streambuf.begin();
-        }
-        return streambuf.begin_prev();
+        return streambuf.begin();
     }
 };
 
@@ -119,7 +119,8 @@ public:
                           ranges::contiguous_range<Source>),
           m_is_borrowed(
               (ranges::range<Source> && ranges::borrowed_range<Source>) ||
-              std::is_same_v<detail::remove_cvref_t<Source>, std::FILE*>)
+              std::is_same_v<detail::remove_cvref_t<Source>, std::FILE*> ||
+              detail::is_istream_source<Source>)
     {
     }
 
@@ -19,6 +19,10 @@
 
 #include <scn/util/meta.h>
 
+#if !SCN_DISABLE_IOSTREAM
+#include <iosfwd>
+#endif
+
 namespace scn {
 SCN_BEGIN_NAMESPACE
 
@@ -375,6 +379,21 @@ using result = decltype(impl<Range>());
 template <typename Range>
 using char_t = typename char_t_fn::result<Range>::type;
 
+/**
+ * `true`, if `Source` is an lvalue reference to a `std::istream`,
+ * or to a type derived from it.
+ * The stream is scanned from through its `std::streambuf`.
+ */
+#if !SCN_DISABLE_IOSTREAM
+template <typename Source>
+inline constexpr bool is_istream_source =
+    std::is_lvalue_reference_v<Source> &&
+    std::is_base_of_v<std::istream, remove_cvref_t<Source>>;
+#else
+template <typename Source>
+inline constexpr bool is_istream_source = false;
+#endif
+
 template <typename Range, typename = void>
 inline constexpr bool is_file_or_narrow_range_impl = false;
 template <>
@@ -387,7 +406,8 @@ inline constexpr bool
 
 template <typename Range>
 inline constexpr bool is_file_or_narrow_range =
-    is_file_or_narrow_range_impl<remove_cvref_t<Range>>;
+    is_file_or_narrow_range_impl<remove_cvref_t<Range>> ||
+    is_istream_source<Range>;
 
 template <typename Range, typename = void>
 inline constexpr bool is_wide_range = false;
@@ -20,9 +20,9 @@
 #if !SCN_DISABLE_REGEX
 
 #include <scn/detail/scanner.h>
+#include <scn/util/small_vector.h>
 
 #include <optional>
-#include <vector>
 
 namespace scn {
 SCN_BEGIN_NAMESPACE
@@ -92,11 +92,24 @@ SCN_BEGIN_NAMESPACE
  * `[[:alpha:]]` can match any non-ASCII characters. Otherwise, only ASCII
  * characters are matched.
  *
+ * Compiling a regular expression is much more expensive than matching it.
+ * The library keeps the most recently used compiled regexes cached,
+ * keyed by pattern and flags, so a pattern in a format string that's scanned
+ * repeatedly is only compiled once.
+ * The size of the cache can be set with the `SCN_REGEX_CACHE_SIZE` macro
+ * when building the library (32 by default, 0 disables caching).
+ *
  * To do regex matching, the scanned type must either be a string
  * (`std::basic_string` or `std::basic_string_view`), or
  * `scn::basic_regex_matches`.
- * Due to limitations of the underlying regex engines,
- * the source must be contiguous.
+ * `std::basic_string_view` and `scn::basic_regex_matches` refer to the
+ * source, so they require a contiguous source.
+ * With the Boost backend (without ICU), `std::basic_string` can also be
+ * read from a non-contiguous source, like `stdin`.
+ * The regex engine then reads the source one character at a time,
+ * only as far as it needs to, and gives the same match as it would
+ * for a contiguous source.
+ * Other backends require a contiguous source for all regex scanning.
  *
  * <table>
  * <caption id="regex-flags-table">
@@ -172,7 +185,7 @@ public:
 #if SCN_REGEX_SUPPORTS_NAMED_CAPTURES
     basic_regex_match(std::basic_string_view<CharT> str,
                       std::basic_string<CharT> name)
-        : m_str(str), m_name(name)
+        : m_str(str), m_name(SCN_MOVE(name))
     {
     }
 #endif
@@ -213,6 +226,12 @@ private:
  * Interface similar to
  * `std::vector<std::optional<basic_regex_match<CharT>>>`.
  *
+ * Up to `inline_capacity` matches (the entire match included)
+ * are stored inline, without allocating.
+ * The matches are views into the source range.
+ * The names of named captures are copied, so they don't allocate
+ * if they fit in the small-string buffer of `std::basic_string`.
+ *
  * \code{.cpp}
  * auto result =
  *     scn::scan<scn::regex_matches>("abc123", "{:/[(a-z]+)([0-9]+)/}");
@@ -226,11 +245,14 @@ private:
  */
 template <typename CharT>
 class basic_regex_matches
-    : private std::vector<std::optional<basic_regex_match<CharT>>> {
-    using base = std::vector<std::optional<basic_regex_match<CharT>>>;
+    : private detail::small_vector<std::optional<basic_regex_match<CharT>>,
+                                   8> {
+    using base =
+        detail::small_vector<std::optional<basic_regex_match<CharT>>, 8>;
 
 public:
     using match_type = basic_regex_match<CharT>;
+    using base::inline_capacity;
     using typename base::const_iterator;
     using typename base::const_reverse_iterator;
     using typename base::iterator;
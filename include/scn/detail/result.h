@@ -161,6 +161,33 @@ private:
     std::FILE* m_file{nullptr};
 };
 
+#if !SCN_DISABLE_IOSTREAM
+struct scan_result_istream_storage {
+public:
+    using range_type = std::istream*;
+
+    constexpr scan_result_istream_storage() = default;
+
+    constexpr scan_result_istream_storage(std::istream* s) : m_stream(s) {}
+
+    /// Stream used for scanning
+    std::istream& stream() const
+    {
+        SCN_EXPECT(m_stream);
+        return *m_stream;
+    }
+
+protected:
+    void assign_range(const scan_result_istream_storage& s)
+    {
+        m_stream = s.m_stream;
+    }
+
+private:
+    std::istream* m_stream{nullptr};
+};
+#endif
+
 struct scan_result_dangling {
     using range_type = ranges::dangling;
 
@@ -201,6 +228,11 @@ constexpr auto get_scan_result_base()
     else if constexpr (std::is_same_v<remove_cvref_t<Range>, std::FILE*>) {
         return type_identity<scan_result_file_storage>{};
     }
+#if !SCN_DISABLE_IOSTREAM
+    else if constexpr (std::is_same_v<remove_cvref_t<Range>, std::istream*>) {
+        return type_identity<scan_result_istream_storage>{};
+    }
+#endif
     else {
         return type_identity<scan_result_range_storage<Range>>{};
     }
@@ -347,6 +379,14 @@ inline auto make_vscan_result_range(std::FILE* source, std::ptrdiff_t)
 {
     return source;
 }
+#if !SCN_DISABLE_IOSTREAM
+template <typename Source,
+          std::enable_if_t<is_istream_source<Source&>>* = nullptr>
+std::istream* make_vscan_result_range(Source& source, std::ptrdiff_t)
+{
+    return std::addressof(source);
+}
+#endif
 }  // namespace detail
 
 SCN_END_NAMESPACE
@@ -147,6 +147,124 @@ SCN_NODISCARD auto scan(Source&& source,
                                             SCN_MOVE(default_args));
 }
 
+namespace detail {
+// Boilerplate for scan(assume_valid_utf8)
+template <typename CharT, typename... Args, typename Source, typename Format>
+auto scan_assume_valid_impl(Source&& source,
+                            Format format,
+                            std::tuple<Args...> default_values)
+    -> scan_result_type<Source, Args...>
+{
+    auto args = make_scan_args<basic_scan_context<CharT>, Args...>(
+        SCN_MOVE(default_values));
+    auto result = vscan(assume_valid_utf8, SCN_FWD(source), format, args);
+    return make_scan_result(SCN_MOVE(result), SCN_MOVE(args));
+}
+}  // namespace detail
+
+/**
+ * `scan` from a source known to be correctly encoded.
+ *
+ * Skips validating the encoding of every scanned string, see
+ * `assume_valid_utf8` for details.
+ *
+ * \code{.cpp}
+ * // `line` has already been validated as UTF-8
+ * auto result = scn::scan<std::string_view, std::string_view>(
+ *     scn::assume_valid_utf8, line, "{} {}");
+ * \endcode
+ *
+ * \ingroup scan
+ */
+template <typename... Args,
+          typename Source,
+          typename = std::enable_if_t<detail::is_file_or_narrow_range<Source>>>
+SCN_NODISCARD auto scan(assume_valid_utf8_t,
+                        Source&& source,
+                        scan_format_string<Source, Args...> format)
+    -> scan_result_type<Source, Args...>
+{
+    return detail::scan_assume_valid_impl<char, Args...>(SCN_FWD(source),
+                                                         format, {});
+}
+
+/**
+ * `scan` from a source known to be correctly encoded, with default values
+ *
+ * \ingroup scan
+ */
+template <typename... Args,
+          typename Source,
+          typename = std::enable_if_t<detail::is_file_or_narrow_range<Source>>>
+SCN_NODISCARD auto scan(assume_valid_utf8_t,
+                        Source&& source,
+                        scan_format_string<Source, Args...> format,
+                        std::tuple<Args...>&& default_args)
+    -> scan_result_type<Source, Args...>
+{
+    return detail::scan_assume_valid_impl<char, Args...>(
+        SCN_FWD(source), format, SCN_MOVE(default_args));
+}
+
+namespace detail {
+// Boilerplate for scan(ascii_source)
+template <typename CharT, typename... Args, typename Source, typename Format>
+auto scan_ascii_source_impl(Source&& source,
+                            Format format,
+                            std::tuple<Args...> default_values)
+    -> scan_result_type<Source, Args...>
+{
+    auto args = make_scan_args<basic_scan_context<CharT>, Args...>(
+        SCN_MOVE(default_values));
+    auto result = vscan(ascii_source, SCN_FWD(source), format, args);
+    return make_scan_result(SCN_MOVE(result), SCN_MOVE(args));
+}
+}  // namespace detail
+
+/**
+ * `scan` from a source expected to be ASCII.
+ *
+ * If the source is contiguous, and turns out to really be ASCII,
+ * it's scanned without decoding any code points, see `ascii_source` for
+ * details.
+ *
+ * \code{.cpp}
+ * auto result = scn::scan<std::string_view, int>(
+ *     scn::ascii_source, "GET 200", "{} {}");
+ * \endcode
+ *
+ * \ingroup scan
+ */
+template <typename... Args,
+          typename Source,
+          typename = std::enable_if_t<detail::is_file_or_narrow_range<Source>>>
+SCN_NODISCARD auto scan(ascii_source_t,
+                        Source&& source,
+                        scan_format_string<Source, Args...> format)
+    -> scan_result_type<Source, Args...>
+{
+    return detail::scan_ascii_source_impl<char, Args...>(SCN_FWD(source),
+                                                         format, {});
+}
+
+/**
+ * `scan` from a source expected to be ASCII, with default values
+ *
+ * \ingroup scan
+ */
+template <typename... Args,
+          typename Source,
+          typename = std::enable_if_t<detail::is_file_or_narrow_range<Source>>>
+SCN_NODISCARD auto scan(ascii_source_t,
+                        Source&& source,
+                        scan_format_string<Source, Args...> format,
+                        std::tuple<Args...>&& default_args)
+    -> scan_result_type<Source, Args...>
+{
+    return detail::scan_ascii_source_impl<char, Args...>(
+        SCN_FWD(source), format, SCN_MOVE(default_args));
+}
+
 namespace detail {
 // Boilerplate for scan(const locale&)
 template <typename CharT,
@@ -111,6 +111,35 @@ public:
 
     SCN_NODISCARD range_type get();
 
+    /**
+     * If `true`, the contents of this buffer are trusted to be correctly
+     * encoded, and readers skip validating the encoding of scanned values.
+     */
+    SCN_NODISCARD bool assumes_valid_encoding() const
+    {
+        return m_assume_valid_encoding;
+    }
+
+    void set_assume_valid_encoding(bool value)
+    {
+        m_assume_valid_encoding = value;
+    }
+
+    /**
+     * If `true`, the contents of this buffer are expected to be ASCII.
+     * Contiguous buffers are then checked to be so once before scanning,
+     * after which everything is processed one code unit at a time.
+     */
+    SCN_NODISCARD bool is_marked_ascii() const
+    {
+        return m_marked_ascii;
+    }
+
+    void set_marked_ascii(bool value)
+    {
+        m_marked_ascii = value;
+    }
+
 protected:
     friend class forward_iterator;
 
@@ -136,6 +165,8 @@ protected:
     std::basic_string_view<char_type> m_current_view{};
     std::basic_string<char_type> m_putback_buffer{};
     bool m_is_contiguous{false};
+    bool m_assume_valid_encoding{false};
+    bool m_marked_ascii{false};
 };
 
 template <typename CharT>
@@ -418,6 +449,33 @@ private:
     std::optional<char_type> m_latest{std::nullopt};
 };
 
+#if !SCN_DISABLE_IOSTREAM
+/**
+ * Scan buffer reading from the `std::streambuf` of a `std::istream`.
+ *
+ * The get area of the streambuf (`[gptr(), egptr())`) is used directly as
+ * the current view, without copying it.
+ * It's only consumed from the streambuf when refilling with `underflow`,
+ * or on `sync`, so unscanned characters are left in the stream.
+ * Unbuffered streambufs are read one character at a time.
+ */
+class scan_istream_buffer : public basic_scan_buffer<char> {
+    using base = basic_scan_buffer<char>;
+
+public:
+    scan_istream_buffer(const std::istream& stream);
+
+    bool fill() override;
+    void sync(std::ptrdiff_t position) override;
+
+private:
+    void consume_from_streambuf(std::ptrdiff_t n);
+
+    std::streambuf* m_streambuf;
+    char_type m_latest{};
+};
+#endif
+
 template <typename CharT>
 class basic_scan_ref_buffer : public basic_scan_buffer<CharT> {
     using base = basic_scan_buffer<CharT>;
@@ -431,6 +489,8 @@ public:
         this->m_current_view = other.get_segment_starting_at(starting_pos);
         m_fill_needs_to_propagate = other.get_segment_starting_at(0).end() ==
                                     this->m_current_view.end();
+        this->m_assume_valid_encoding = other.assumes_valid_encoding();
+        this->m_marked_ascii = other.is_marked_ascii();
     }
 
     basic_scan_ref_buffer(std::basic_string_view<CharT> view)
@@ -490,6 +550,13 @@ inline auto make_file_scan_buffer(std::FILE* file)
 {
     return scan_file_buffer(file);
 }
+
+#if !SCN_DISABLE_IOSTREAM
+inline auto make_istream_scan_buffer(const std::istream& stream)
+{
+    return scan_istream_buffer(stream);
+}
+#endif
 }  // namespace detail
 
 SCN_END_NAMESPACE
@@ -61,7 +61,79 @@ scan_expected<ranges::iterator_t<Range>> internal_skip_classic_whitespace(
 
 SCN_DECLARE_EXTERN_SCANNER_SCAN_FOR_CTX(scan_context)
 
+template <typename CharT>
+bool is_scan_iterator_contiguous(
+    const typename basic_scan_buffer<CharT>::forward_iterator& it)
+{
+    return !it.stores_parent() || it.parent()->is_contiguous();
+}
 }  // namespace detail
 
+/**
+ * `scanner` for strings with a custom allocator or character traits,
+ * like `std::pmr::string`.
+ * Accepts the same format specifiers as `std::basic_string<CharT>`.
+ *
+ * When scanning from a contiguous source of the same character type,
+ * the characters are copied straight into `val`,
+ * so every allocation goes through its allocator.
+ * Otherwise, they're first read into a `std::basic_string<CharT>`.
+ *
+ * \code{.cpp}
+ * std::pmr::monotonic_buffer_resource arena{};
+ * // The initial value is scanned into, so it keeps its allocator
+ * auto result = scn::scan<std::pmr::string>(
+ *     "abc", "{}", std::tuple{std::pmr::string{&arena}});
+ * // result->value() == "abc", allocated from `arena`
+ * \endcode
+ *
+ * \ingroup format-string
+ */
+template <typename CharT,
+          typename Traits,
+          typename Allocator,
+          typename SourceCharT>
+struct scanner<std::basic_string<CharT, Traits, Allocator>,
+               SourceCharT,
+               std::enable_if_t<!std::is_same_v<
+                   std::basic_string<CharT, Traits, Allocator>,
+                   std::basic_string<CharT>>>> {
+    using builtin_type = std::basic_string<CharT>;
+
+    template <typename ParseCtx>
+    constexpr auto parse(ParseCtx& pctx)
+        -> scan_expected<typename ParseCtx::iterator>
+    {
+        SCN_TRY(it, detail::scanner_parse_for_builtin_type<builtin_type>(
+                        pctx, m_specs));
+        pctx.advance_to(it);
+        return it;
+    }
+
+    template <typename Context>
+    scan_expected<typename Context::iterator> scan(
+        std::basic_string<CharT, Traits, Allocator>& val,
+        Context& ctx) const
+    {
+        if constexpr (std::is_same_v<CharT, typename Context::char_type>) {
+            if (detail::is_scan_iterator_contiguous<CharT>(ctx.begin())) {
+                std::basic_string_view<CharT> sv{};
+                SCN_TRY(it, detail::scanner_scan_for_builtin_type(
+                                sv, ctx, m_specs));
+                val.assign(sv.data(), sv.size());
+                return it;
+            }
+        }
+
+        builtin_type tmp{};
+        SCN_TRY(it, detail::scanner_scan_for_builtin_type(tmp, ctx, m_specs));
+        val.assign(tmp.data(), tmp.size());
+        return it;
+    }
+
+private:
+    detail::format_specs m_specs;
+};
+
 SCN_END_NAMESPACE
 }  // namespace scn
@@ -20,6 +20,9 @@
 #include <scn/detail/ranges.h>
 #include <scn/detail/scanner.h>
 #include <scn/detail/scanner_builtin.h>
+#include <scn/util/span.h>
+
+#include <array>
 
 // experimental
 
@@ -146,6 +149,28 @@ struct is_range
               !std::is_convertible_v<T, std::basic_string<CharT>> &&
               !std::is_convertible_v<T, std::basic_string_view<CharT>>> {};
 
+template <typename T>
+struct is_std_pair : std::false_type {};
+template <typename First, typename Second>
+struct is_std_pair<std::pair<First, Second>> : std::true_type {};
+
+/**
+ * Whether the separators of a range of `T` can be counted to estimate its
+ * size: `T` can't be a range or a tuple, because their separators
+ * would be counted, too.
+ * A `std::pair` of non-ranges is allowed, because the key and the value
+ * of a map entry are separated with `:`. Scanned on its own, a pair is
+ * separated with `,`, which `range_scanner` checks before counting.
+ */
+template <typename T, typename CharT>
+struct is_flat_range_element
+    : std::bool_constant<!is_range<T, CharT>::value &&
+                         !is_tuple_like<T>::value> {};
+template <typename First, typename Second, typename CharT>
+struct is_flat_range_element<std::pair<First, Second>, CharT>
+    : std::bool_constant<!is_range<First, CharT>::value &&
+                         !is_range<Second, CharT>::value> {};
+
 template <typename Source, typename CharT>
 scan_expected<ranges::iterator_t<Source>> scan_str(
     Source source,
@@ -187,6 +212,16 @@ struct has_element_insert<
     std::void_t<decltype(SCN_DECLVAL(Range&).insert(SCN_DECLVAL(Element&&)))>>
     : std::true_type {};
 
+template <typename Range, typename Element, typename Enable = void>
+struct has_emplace_hint : std::false_type {};
+template <typename Range, typename Element>
+struct has_emplace_hint<
+    Range,
+    Element,
+    std::void_t<decltype(SCN_DECLVAL(Range&).emplace_hint(
+        SCN_DECLVAL(Range&).end(),
+        SCN_DECLVAL(Element&&)))>> : std::true_type {};
+
 template <typename Range,
           typename Element,
           typename = std::enable_if_t<!std::is_reference_v<Element>>>
@@ -199,6 +234,10 @@ void add_element_to_range(Range& r, Element&& elem)
     else if constexpr (has_push<Range, elem_type>::value) {
         r.push(SCN_MOVE(elem));
     }
+    else if constexpr (has_emplace_hint<Range, elem_type>::value) {
+        // Constant time for ordered containers, if the input is sorted
+        r.emplace_hint(r.end(), SCN_MOVE(elem));
+    }
     else if constexpr (has_element_insert<Range, elem_type>::value) {
         r.insert(SCN_MOVE(elem));
     }
@@ -213,10 +252,23 @@ template <typename Range>
 struct has_max_size<Range, decltype(SCN_DECLVAL(const Range&).max_size())>
     : std::true_type {};
 
+/**
+ * Ranges with fixed storage, that are scanned into in place,
+ * instead of inserting elements: `scn::span` and `std::array`.
+ * A `span` is shrunk to the scanned elements,
+ * a `std::array` needs to be filled completely.
+ */
+template <typename Range>
+struct is_fixed_size_range
+    : std::bool_constant<is_span<Range> || is_std_array<Range>> {};
+
 template <typename Range, typename DiffT = ranges::range_difference_t<Range>>
 DiffT range_max_size(const Range& r)
 {
-    if constexpr (has_max_size<Range>::value) {
+    if constexpr (is_fixed_size_range<Range>::value) {
+        return static_cast<DiffT>(r.size());
+    }
+    else if constexpr (has_max_size<Range>::value) {
         return static_cast<DiffT>(r.max_size());
     }
     else {
@@ -224,6 +276,125 @@ DiffT range_max_size(const Range& r)
     }
 }
 
+template <typename Range, typename Enable = void>
+struct has_reserve : std::false_type {};
+template <typename Range>
+struct has_reserve<Range,
+                   std::void_t<decltype(SCN_DECLVAL(Range&).reserve(
+                       SCN_DECLVAL(typename Range::size_type)))>>
+    : std::true_type {};
+
+template <typename Range, typename Element, typename Enable = void>
+struct has_bulk_insert : std::false_type {};
+template <typename Range, typename Element>
+struct has_bulk_insert<
+    Range,
+    Element,
+    std::void_t<decltype(SCN_DECLVAL(Range&).insert(
+        SCN_DECLVAL(Range&).end(),
+        SCN_DECLVAL(const Element*),
+        SCN_DECLVAL(const Element*)))>> : std::true_type {};
+
+#define SCN_FOR_EACH_BULK_RANGE_ELEMENT_TYPE(Macro, Context) \
+    Macro(signed char, Context)                              \
+    Macro(short, Context)                                    \
+    Macro(int, Context)                                      \
+    Macro(long, Context)                                     \
+    Macro(long long, Context)                                \
+    Macro(unsigned char, Context)                            \
+    Macro(unsigned short, Context)                           \
+    Macro(unsigned int, Context)                             \
+    Macro(unsigned long, Context)                            \
+    Macro(unsigned long long, Context)                       \
+    Macro(float, Context)                                    \
+    Macro(double, Context)                                   \
+    Macro(long double, Context)
+
+/**
+ * Element types, for which a range can be scanned with
+ * `scan_range_elements`, instead of going through `scanner<T>`
+ * once per element
+ */
+template <typename T>
+struct is_bulk_range_element
+    : std::disjunction<std::is_same<T, signed char>,
+                       std::is_same<T, short>,
+                       std::is_same<T, int>,
+                       std::is_same<T, long>,
+                       std::is_same<T, long long>,
+                       std::is_same<T, unsigned char>,
+                       std::is_same<T, unsigned short>,
+                       std::is_same<T, unsigned int>,
+                       std::is_same<T, unsigned long>,
+                       std::is_same<T, unsigned long long>,
+                       std::is_same<T, float>,
+                       std::is_same<T, double>,
+                       std::is_same<T, long double>> {};
+
+/**
+ * Estimates how many elements there are in the range at the beginning of
+ * `ctx`, by counting separators in the part of the source that's already
+ * available. Never reads more input.
+ * Returns 0 if no estimate can be made.
+ */
+template <typename Context>
+std::size_t estimate_range_element_count(
+    Context& ctx,
+    std::basic_string_view<typename Context::char_type> separator,
+    std::basic_string_view<typename Context::char_type> closing_bracket);
+
+/**
+ * Scans up to `max_count` elements into `elements`, as if with `{}`,
+ * stopping before `closing_bracket`.
+ * `count` is set to the number of elements scanned.
+ */
+template <typename T, typename Context>
+scan_expected<typename Context::iterator> scan_range_elements(
+    Context& ctx,
+    std::basic_string_view<typename Context::char_type> separator,
+    std::basic_string_view<typename Context::char_type> closing_bracket,
+    bool is_first,
+    T* elements,
+    std::size_t max_count,
+    std::size_t& count);
+
+#define SCN_DECLARE_EXTERN_SCAN_RANGE_ELEMENTS_FOR_TYPE(T, Context)       \
+    extern template scan_expected<Context::iterator> scan_range_elements( \
+        Context&, std::basic_string_view<Context::char_type>,             \
+        std::basic_string_view<Context::char_type>, bool, T*,             \
+        std::size_t, std::size_t&);
+
+extern template std::size_t estimate_range_element_count(
+    scan_context&,
+    std::string_view,
+    std::string_view);
+extern template std::size_t estimate_range_element_count(
+    wscan_context&,
+    std::wstring_view,
+    std::wstring_view);
+SCN_FOR_EACH_BULK_RANGE_ELEMENT_TYPE(
+    SCN_DECLARE_EXTERN_SCAN_RANGE_ELEMENTS_FOR_TYPE,
+    scan_context)
+SCN_FOR_EACH_BULK_RANGE_ELEMENT_TYPE(
+    SCN_DECLARE_EXTERN_SCAN_RANGE_ELEMENTS_FOR_TYPE,
+    wscan_context)
+#undef SCN_DECLARE_EXTERN_SCAN_RANGE_ELEMENTS_FOR_TYPE
+
+template <typename Range>
+scan_error finish_fixed_size_range(Range& range, std::size_t count)
+{
+    if constexpr (is_span<Range>) {
+        range = range.first(count);
+    }
+    else {
+        if (SCN_UNLIKELY(count != range.size())) {
+            return {scan_error::invalid_scanned_value,
+                    "Too few elements for a std::array"};
+        }
+    }
+    return {};
+}
+
 template <typename CharT>
 class range_scanner_base {
 public:
@@ -238,6 +409,11 @@ public:
         m_closing_bracket = close;
     }
 
+    constexpr std::basic_string_view<CharT> separator() const
+    {
+        return m_separator;
+    }
+
 protected:
     constexpr range_scanner_base() = default;
 
@@ -250,28 +426,103 @@ template <typename CharT>
 class range_scanner_base_for_ranges : public range_scanner_base<CharT> {
 protected:
     template <typename T, typename Scan, typename Range, typename Context>
-    scan_expected<typename Context::iterator> scan_impl(Scan scan_cb,
-                                                        Range& range,
-                                                        Context& ctx) const
+    scan_expected<typename Context::iterator> scan_impl(
+        Scan scan_cb,
+        Range& range,
+        Context& ctx,
+        bool elements_contain_separator) const
     {
         SCN_TRY(it, detail::scan_str(ctx.range(), this->m_opening_bracket));
         ctx.advance_to(it);
 
+        if constexpr (detail::has_reserve<Range>::value &&
+                      detail::is_flat_range_element<T, CharT>::value &&
+                      std::is_same_v<Context, basic_scan_context<CharT>>) {
+            if (!elements_contain_separator) {
+                reserve_for_elements(range, ctx);
+            }
+        }
+
         using diff_type = ranges::range_difference_t<Range>;
-        for (diff_type i = 0; i < detail::range_max_size(range); ++i) {
+        diff_type i = 0;
+        for (; i < detail::range_max_size(range); ++i) {
             if (auto e = detail::scan_str(ctx.range(), this->m_closing_bracket);
                 e) {
                 break;
             }
 
-            T elem{};
-            if (auto e = scan_inner_loop(scan_cb, ctx, elem, i == 0);
-                SCN_LIKELY(e)) {
-                detail::add_element_to_range(range, SCN_MOVE(elem));
-                ctx.advance_to(*e);
+            if constexpr (detail::is_fixed_size_range<Range>::value) {
+                auto& elem = range[static_cast<std::size_t>(i)];
+                SCN_TRY(elem_it, scan_inner_loop(scan_cb, ctx, elem, i == 0));
+                ctx.advance_to(elem_it);
             }
             else {
-                return e;
+                T elem{};
+                if (auto e = scan_inner_loop(scan_cb, ctx, elem, i == 0);
+                    SCN_LIKELY(e)) {
+                    detail::add_element_to_range(range, SCN_MOVE(elem));
+                    ctx.advance_to(*e);
+                }
+                else {
+                    return e;
+                }
+            }
+        }
+
+        if constexpr (detail::is_fixed_size_range<Range>::value) {
+            if (auto e = detail::finish_fixed_size_range(
+                    range, static_cast<std::size_t>(i));
+                SCN_UNLIKELY(!e)) {
+                return unexpected(e);
+            }
+        }
+        return detail::scan_str(ctx.range(), this->m_closing_bracket);
+    }
+
+    /**
+     * Scans a range of arithmetic values (like `std::vector<int>`),
+     * reserving space for the elements up front,
+     * and inserting them in chunks, read without going through
+     * `scanner<T>` for every element.
+     * Fixed-size ranges are read into directly.
+     */
+    template <typename T, typename Range, typename Context>
+    scan_expected<typename Context::iterator> scan_bulk_impl(
+        Range& range,
+        Context& ctx) const
+    {
+        SCN_TRY(it, detail::scan_str(ctx.range(), this->m_opening_bracket));
+        ctx.advance_to(it);
+
+        if constexpr (detail::is_fixed_size_range<Range>::value) {
+            std::size_t count{0};
+            SCN_TRY(elem_it,
+                    detail::scan_range_elements(
+                        ctx, this->m_separator, this->m_closing_bracket, true,
+                        range.data(), range.size(), count));
+            ctx.advance_to(elem_it);
+            if (auto e = detail::finish_fixed_size_range(range, count);
+                SCN_UNLIKELY(!e)) {
+                return unexpected(e);
+            }
+        }
+        else {
+            reserve_for_elements(range, ctx);
+
+            std::array<T, 64> chunk{};
+            bool is_first = true;
+            while (true) {
+                std::size_t count{0};
+                SCN_TRY(elem_it,
+                        detail::scan_range_elements(
+                            ctx, this->m_separator, this->m_closing_bracket,
+                            is_first, chunk.data(), chunk.size(), count));
+                ctx.advance_to(elem_it);
+                range.insert(range.end(), chunk.data(), chunk.data() + count);
+                if (count < chunk.size()) {
+                    break;
+                }
+                is_first = false;
             }
         }
 
@@ -279,6 +530,17 @@ protected:
     }
 
 private:
+    template <typename Range, typename Context>
+    void reserve_for_elements(Range& range, Context& ctx) const
+    {
+        if (const auto n = detail::estimate_range_element_count(
+                ctx, this->m_separator, this->m_closing_bracket);
+            n != 0) {
+            range.reserve(
+                static_cast<typename Range::size_type>(range.size() + n));
+        }
+    }
+
     template <typename Scan, typename Context, typename Elem>
     scan_expected<typename Context::iterator>
     scan_inner_loop(Scan scan_cb, Context& ctx, Elem& elem, bool is_first) const
@@ -298,10 +560,6 @@ private:
     }
 };
 
-template <typename T>
-struct is_std_pair : std::false_type {};
-template <typename First, typename Second>
-struct is_std_pair<std::pair<First, Second>> : std::true_type {};
 }  // namespace detail
 
 template <typename Tuple, typename CharT>
@@ -399,6 +657,8 @@ public:
     constexpr scan_expected<typename ParseCtx::iterator> parse(ParseCtx& pctx)
     {
         // TODO
+        m_has_default_element_specs =
+            pctx.begin() == pctx.end() || *pctx.begin() == CharT{'}'};
         return m_underlying.parse(pctx);
     }
 
@@ -406,13 +666,43 @@ public:
     scan_expected<typename Context::iterator> scan(Range& range,
                                                    Context& ctx) const
     {
+        if constexpr (detail::is_bulk_range_element<T>::value &&
+                      (detail::is_fixed_size_range<Range>::value ||
+                       (detail::has_reserve<Range>::value &&
+                        detail::has_bulk_insert<Range, T>::value)) &&
+                      std::is_same_v<Context, basic_scan_context<CharT>>) {
+            if (m_has_default_element_specs) {
+                return this->template scan_bulk_impl<T>(range, ctx);
+            }
+        }
+
         return this->template scan_impl<T>(
             [&](T& v, Context& c, bool) { return m_underlying.scan(v, c); },
-            range, ctx);
+            range, ctx, elements_contain_separator());
     }
 
 private:
+    /// Whether the separator of this range also separates the members of
+    /// an element, like in `[(1, 2), (3, 4)]`, but not in `{1: 2, 3: 4}`
+    constexpr bool elements_contain_separator() const
+    {
+        using underlying_type = detail::range_scanner_type<CharT, T>;
+        if constexpr (detail::is_std_pair<T>::value) {
+            if constexpr (std::is_base_of_v<detail::range_scanner_base<CharT>,
+                                            underlying_type>) {
+                return m_underlying.separator() == this->m_separator;
+            }
+            else {
+                return true;
+            }
+        }
+        else {
+            return false;
+        }
+    }
+
     detail::range_scanner_type<CharT, T> m_underlying;
+    bool m_has_default_element_specs{true};
 };
 
 enum class range_format {
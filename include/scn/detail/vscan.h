@@ -31,17 +31,30 @@ SCN_BEGIN_NAMESPACE
  */
 
 namespace detail {
+#if !SCN_DISABLE_IOSTREAM
+template <typename Source>
+using scan_result_stream_or_range_type =
+    std::conditional_t<is_istream_source<Source>,
+                       std::istream*,
+                       borrowed_subrange_with_sentinel_t<Source>>;
+#else
+template <typename Source>
+using scan_result_stream_or_range_type =
+    borrowed_subrange_with_sentinel_t<Source>;
+#endif
+
 template <typename Source>
 using scan_result_value_type =
     std::conditional_t<std::is_same_v<remove_cvref_t<Source>, std::FILE*>,
                        std::FILE*,
-                       borrowed_subrange_with_sentinel_t<Source>>;
+                       scan_result_stream_or_range_type<Source>>;
 }
 
 /**
  * Result type returned by `vscan`.
  *
  * The value type of the `scan_expected` is `FILE*` if `Source` is `FILE*`,
+ * `std::istream*` if `Source` is a `std::istream&`,
  * `borrowed_subrange_with_sentinel_t<Source>` otherwise.
  *
  * \ingroup vscan
@@ -49,6 +62,64 @@ using scan_result_value_type =
 template <typename Source>
 using vscan_result = scan_expected<detail::scan_result_value_type<Source>>;
 
+/**
+ * Tag type for `assume_valid_utf8`.
+ *
+ * \ingroup vscan
+ */
+struct assume_valid_utf8_t {
+    explicit assume_valid_utf8_t() = default;
+};
+
+/**
+ * Pass as the first argument to `scan` to promise that the source is
+ * valid UTF-8, for example because it has already been validated once when
+ * it was read in.
+ *
+ * Scanned strings and string_views are then no longer validated one by one,
+ * and transcoding them uses the conversions for known-valid input.
+ * Giving an incorrectly encoded source in this mode is undefined behavior.
+ *
+ * \code{.cpp}
+ * auto result = scn::scan<std::string>(scn::assume_valid_utf8, input, "{}");
+ * \endcode
+ *
+ * \ingroup vscan
+ */
+inline constexpr assume_valid_utf8_t assume_valid_utf8{};
+
+/**
+ * Tag type for `ascii_source`.
+ *
+ * \ingroup vscan
+ */
+struct ascii_source_t {
+    explicit ascii_source_t() = default;
+};
+
+/**
+ * Pass as the first argument to `scan` to tell that the source is expected
+ * to be 7-bit ASCII, like most protocol and log text.
+ *
+ * A contiguous source is checked to be ASCII while scanning it,
+ * with a vectorized check for set high bits. Only the parts of the source
+ * values are read from are checked, in geometrically growing chunks,
+ * so scanning a few values from the front of a large source stays cheap.
+ * While the check holds, no code points are decoded: the source is
+ * processed one code unit at a time, and scanned strings are not validated.
+ * Once it fails, the rest of the source is scanned normally,
+ * so giving a non-ASCII source is not an error, just slower.
+ * Non-contiguous sources can't be checked,
+ * and are always scanned normally.
+ *
+ * \code{.cpp}
+ * auto result = scn::scan<std::string, int>(scn::ascii_source, line, "{} {}");
+ * \endcode
+ *
+ * \ingroup vscan
+ */
+inline constexpr ascii_source_t ascii_source{};
+
 namespace detail {
 scan_expected<std::ptrdiff_t> vscan_impl(std::string_view source,
                                          std::string_view format,
@@ -117,6 +188,34 @@ auto vscan_generic(Range&& range,
     return make_vscan_result_range(SCN_FWD(range), *result);
 }
 
+/// `vscan_generic`, with the scan buffer configured by `setup_buffer`
+template <typename Range, typename CharT, typename SetupBuffer>
+auto vscan_with_buffer_setup_generic(
+    Range&& range,
+    std::basic_string_view<CharT> format,
+    basic_scan_args<basic_scan_context<CharT>> args,
+    SetupBuffer setup_buffer) -> vscan_result<Range>
+{
+    auto buffer = make_scan_buffer(range);
+
+    auto result = [&]() {
+        if constexpr (is_specialization_of_v<decltype(buffer),
+                                             std::basic_string_view>) {
+            auto string_buffer = make_string_scan_buffer(buffer);
+            setup_buffer(string_buffer);
+            return vscan_impl(string_buffer, format, args);
+        }
+        else {
+            setup_buffer(buffer);
+            return vscan_impl(buffer, format, args);
+        }
+    }();
+    if (SCN_UNLIKELY(!result)) {
+        return unexpected(result.error());
+    }
+    return make_vscan_result_range(SCN_FWD(range), *result);
+}
+
 template <typename Locale, typename Range, typename CharT>
 auto vscan_localized_generic(const Locale& loc,
                              Range&& range,
@@ -174,6 +273,42 @@ auto vscan(Source&& source, std::string_view format, scan_args args)
     return detail::vscan_generic(SCN_FWD(source), format, args);
 }
 
+/**
+ * Perform actual scanning from `source`, according to `format`, into the
+ * type-erased arguments at `args`, without validating the encoding of
+ * scanned values. Called by `scan(assume_valid_utf8, ...)`.
+ *
+ * \ingroup vscan
+ */
+template <typename Source>
+auto vscan(assume_valid_utf8_t,
+           Source&& source,
+           std::string_view format,
+           scan_args args) -> vscan_result<Source>
+{
+    return detail::vscan_with_buffer_setup_generic(
+        SCN_FWD(source), format, args,
+        [](auto& buffer) { buffer.set_assume_valid_encoding(true); });
+}
+
+/**
+ * Perform actual scanning from `source`, according to `format`, into the
+ * type-erased arguments at `args`, processing the source one code unit at a
+ * time if it's ASCII. Called by `scan(ascii_source, ...)`.
+ *
+ * \ingroup vscan
+ */
+template <typename Source>
+auto vscan(ascii_source_t,
+           Source&& source,
+           std::string_view format,
+           scan_args args) -> vscan_result<Source>
+{
+    return detail::vscan_with_buffer_setup_generic(
+        SCN_FWD(source), format, args,
+        [](auto& buffer) { buffer.set_marked_ascii(true); });
+}
+
 /**
  * Perform actual scanning from `source`, according to `format`, into the
  * type-erased arguments at `args`, using `loc`, if requested. Called by
@@ -56,6 +56,12 @@ class basic_scan_context;
 using scan_context = basic_scan_context<char>;
 using wscan_context = basic_scan_context<wchar_t>;
 
+template <typename CharT>
+class basic_contiguous_scan_context;
+
+using contiguous_scan_context = basic_contiguous_scan_context<char>;
+using wcontiguous_scan_context = basic_contiguous_scan_context<wchar_t>;
+
 using scan_args = basic_scan_args<scan_context>;
 using wscan_args = basic_scan_args<wscan_context>;
 
@@ -169,6 +175,21 @@ struct scanner {
 template <typename T, typename CharT>
 inline constexpr bool has_scanner = std::is_constructible_v<scanner<T, CharT>>;
 
+/**
+ * Specialize to `std::true_type` to have `scanner<T, CharT>::scan` called with
+ * a `basic_contiguous_scan_context`, instead of a `basic_scan_context`,
+ * when scanning from a contiguous source.
+ * The `scan` member function of such a scanner must accept both contexts.
+ *
+ * Without it, a custom type scanned from a contiguous source is scanned
+ * through a `basic_scan_context` over the rest of the source,
+ * losing the fast paths for contiguous ranges.
+ *
+ * \ingroup ctx
+ */
+template <typename T, typename CharT = char>
+struct scanner_supports_contiguous_context : std::false_type {};
+
 template <typename T>
 struct discard;
 
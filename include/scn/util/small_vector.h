@@ -0,0 +1,411 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#pragma once
+
+#include <scn/util/memory.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+
+#if SCN_USE_EXCEPTIONS
+#include <stdexcept>
+#endif
+
+namespace scn {
+SCN_BEGIN_NAMESPACE
+
+namespace detail {
+/**
+ * A `std::vector`-like container,
+ * which stores up to `N` elements inline, without allocating.
+ * Only moves to the heap when it grows beyond that.
+ */
+template <typename T, std::size_t N>
+class small_vector {
+    static_assert(N > 0);
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+
+    using iterator = pointer;
+    using const_iterator = const_pointer;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type inline_capacity = N;
+
+    small_vector() = default;
+
+    explicit small_vector(size_type count)
+    {
+        resize(count);
+    }
+    small_vector(size_type count, const T& value)
+    {
+        resize(count, value);
+    }
+
+    template <typename InputIt,
+              std::enable_if_t<!std::is_integral_v<InputIt>>* = nullptr>
+    small_vector(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+    small_vector(std::initializer_list<T> il)
+        : small_vector(il.begin(), il.end())
+    {
+    }
+
+    small_vector(const small_vector& other)
+    {
+        reserve(other.size());
+        std::uninitialized_copy(other.begin(), other.end(), m_data);
+        m_size = other.m_size;
+    }
+    small_vector(small_vector&& other) noexcept(
+        std::is_nothrow_move_constructible_v<T>)
+    {
+        take(other);
+    }
+
+    small_vector& operator=(const small_vector& other)
+    {
+        if (this != &other) {
+            clear();
+            reserve(other.size());
+            std::uninitialized_copy(other.begin(), other.end(), m_data);
+            m_size = other.m_size;
+        }
+        return *this;
+    }
+    small_vector& operator=(small_vector&& other) noexcept(
+        std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other) {
+            clear();
+            free_heap();
+            take(other);
+        }
+        return *this;
+    }
+
+    ~small_vector()
+    {
+        clear();
+        free_heap();
+    }
+
+    size_type size() const
+    {
+        return m_size;
+    }
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+    size_type capacity() const
+    {
+        return m_capacity;
+    }
+
+    T* data()
+    {
+        return m_data;
+    }
+    const T* data() const
+    {
+        return m_data;
+    }
+
+    iterator begin()
+    {
+        return m_data;
+    }
+    const_iterator begin() const
+    {
+        return m_data;
+    }
+    const_iterator cbegin() const
+    {
+        return m_data;
+    }
+    iterator end()
+    {
+        return m_data + m_size;
+    }
+    const_iterator end() const
+    {
+        return m_data + m_size;
+    }
+    const_iterator cend() const
+    {
+        return m_data + m_size;
+    }
+
+    reverse_iterator rbegin()
+    {
+        return reverse_iterator{end()};
+    }
+    const_reverse_iterator rbegin() const
+    {
+        return const_reverse_iterator{end()};
+    }
+    reverse_iterator rend()
+    {
+        return reverse_iterator{begin()};
+    }
+    const_reverse_iterator rend() const
+    {
+        return const_reverse_iterator{begin()};
+    }
+
+    T& operator[](size_type i)
+    {
+        SCN_EXPECT(i < m_size);
+        return m_data[i];
+    }
+    const T& operator[](size_type i) const
+    {
+        SCN_EXPECT(i < m_size);
+        return m_data[i];
+    }
+
+    T& at(size_type i)
+    {
+        check_index(i);
+        return m_data[i];
+    }
+    const T& at(size_type i) const
+    {
+        check_index(i);
+        return m_data[i];
+    }
+
+    T& front()
+    {
+        return (*this)[0];
+    }
+    const T& front() const
+    {
+        return (*this)[0];
+    }
+    T& back()
+    {
+        return (*this)[m_size - 1];
+    }
+    const T& back() const
+    {
+        return (*this)[m_size - 1];
+    }
+
+    void reserve(size_type new_cap)
+    {
+        if (new_cap <= m_capacity) {
+            return;
+        }
+
+        auto new_data = std::allocator<T>{}.allocate(new_cap);
+        std::uninitialized_move(begin(), end(), new_data);
+        std::destroy(begin(), end());
+        free_heap();
+        m_data = new_data;
+        m_capacity = new_cap;
+    }
+
+    void resize(size_type count)
+    {
+        resize_impl(count, [](T* p) { ::new (static_cast<void*>(p)) T(); });
+    }
+    void resize(size_type count, const T& value)
+    {
+        resize_impl(count,
+                    [&](T* p) { ::new (static_cast<void*>(p)) T(value); });
+    }
+
+    void clear()
+    {
+        std::destroy(begin(), end());
+        m_size = 0;
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (m_size == m_capacity) {
+            // Construct first: args may refer to an element of *this
+            T tmp(SCN_FWD(args)...);
+            reserve(next_capacity(m_size + 1));
+            ::new (static_cast<void*>(end())) T(SCN_MOVE(tmp));
+        }
+        else {
+            ::new (static_cast<void*>(end())) T(SCN_FWD(args)...);
+        }
+        ++m_size;
+        return back();
+    }
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+    void push_back(T&& value)
+    {
+        emplace_back(SCN_MOVE(value));
+    }
+    void pop_back()
+    {
+        SCN_EXPECT(m_size > 0);
+        --m_size;
+        std::destroy_at(end());
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args)
+    {
+        SCN_EXPECT(pos >= begin() && pos <= end());
+        const auto idx = pos - cbegin();
+        emplace_back(SCN_FWD(args)...);
+        std::rotate(begin() + idx, end() - 1, end());
+        return begin() + idx;
+    }
+    iterator insert(const_iterator pos, const T& value)
+    {
+        return emplace(pos, value);
+    }
+    iterator insert(const_iterator pos, T&& value)
+    {
+        return emplace(pos, SCN_MOVE(value));
+    }
+
+    void swap(small_vector& other) noexcept(
+        std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this == &other) {
+            return;
+        }
+        if (is_on_heap() && other.is_on_heap()) {
+            std::swap(m_data, other.m_data);
+            std::swap(m_size, other.m_size);
+            std::swap(m_capacity, other.m_capacity);
+            return;
+        }
+        small_vector tmp{SCN_MOVE(other)};
+        other = SCN_MOVE(*this);
+        *this = SCN_MOVE(tmp);
+    }
+
+    friend void swap(small_vector& a, small_vector& b) noexcept(
+        noexcept(a.swap(b)))
+    {
+        a.swap(b);
+    }
+
+    friend bool operator==(const small_vector& a, const small_vector& b)
+    {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end());
+    }
+    friend bool operator!=(const small_vector& a, const small_vector& b)
+    {
+        return !(a == b);
+    }
+
+private:
+    T* inline_data()
+    {
+        return reinterpret_cast<T*>(m_storage);
+    }
+
+    bool is_on_heap() const
+    {
+        return m_capacity > N;
+    }
+
+    void free_heap()
+    {
+        if (is_on_heap()) {
+            std::allocator<T>{}.deallocate(m_data, m_capacity);
+            m_data = inline_data();
+            m_capacity = N;
+        }
+    }
+
+    // Requires *this to be empty and inline
+    void take(small_vector& other)
+    {
+        if (other.is_on_heap()) {
+            m_data = std::exchange(other.m_data, other.inline_data());
+            m_capacity = std::exchange(other.m_capacity, N);
+        }
+        else {
+            std::uninitialized_move(other.begin(), other.end(), m_data);
+            std::destroy(other.begin(), other.end());
+        }
+        m_size = std::exchange(other.m_size, 0);
+    }
+
+    size_type next_capacity(size_type min_cap) const
+    {
+        return (std::max)(m_capacity * 2, min_cap);
+    }
+
+    template <typename Construct>
+    void resize_impl(size_type count, Construct construct)
+    {
+        if (count < m_size) {
+            std::destroy(begin() + count, end());
+            m_size = count;
+            return;
+        }
+
+        reserve(count);
+        for (; m_size < count; ++m_size) {
+            construct(end());
+        }
+    }
+
+    void check_index(size_type i) const
+    {
+#if SCN_USE_EXCEPTIONS
+        if (SCN_UNLIKELY(i >= m_size)) {
+            throw std::out_of_range("small_vector index out of range");
+        }
+#else
+        SCN_EXPECT(i < m_size);
+#endif
+    }
+
+    alignas(T) unsigned char m_storage[N * sizeof(T)];
+    T* m_data{reinterpret_cast<T*>(m_storage)};
+    size_type m_size{0};
+    size_type m_capacity{N};
+};
+}  // namespace detail
+
+SCN_END_NAMESPACE
+}  // namespace scn
@@ -65,16 +65,25 @@ template <typename S, typename It>
 inline constexpr bool is_span_compatible_sentinel =
     ranges_std::sized_sentinel_for<S, It> && !std::is_convertible_v<S, size_t>;
 
+// Split in two, so that range_reference_t<R> is only looked at
+// if R is a contiguous range
+template <typename R,
+          typename T,
+          bool = ranges::contiguous_range<R> && ranges::sized_range<R>>
+inline constexpr bool is_span_compatible_contiguous_range = false;
 template <typename R, typename T>
-inline constexpr bool is_span_compatible_range =
-    !std::is_array_v<detail::remove_cvref_t<R>> &&
-    !is_span<detail::remove_cvref_t<R>> &&
-    !is_std_array<detail::remove_cvref_t<R>> && ranges::contiguous_range<R> &&
-    ranges::sized_range<R> &&
+inline constexpr bool is_span_compatible_contiguous_range<R, T, true> =
     (ranges::borrowed_range<R> || std::is_const_v<T>)&&std::is_convertible_v<
         std::remove_reference_t<ranges::range_reference_t<R>> (*)[],
         T (*)[]>;
 
+template <typename R, typename T>
+inline constexpr bool is_span_compatible_range =
+    !std::is_array_v<detail::remove_cvref_t<R>> &&
+    !is_span<detail::remove_cvref_t<R>> &&
+    !is_std_array<detail::remove_cvref_t<R>> &&
+    is_span_compatible_contiguous_range<R, T>;
+
 template <typename T, typename = size_t>
 inline constexpr bool is_complete = false;
 template <typename T>
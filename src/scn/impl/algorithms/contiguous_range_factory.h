@@ -241,6 +241,46 @@ auto make_contiguous_buffer(Range&& range)
         return contiguous_range_factory{SCN_FWD(range)};
     }
 }
+
+/**
+ * Like `make_contiguous_buffer`, but if `range` needs to be copied,
+ * it's copied into `scratch`, reusing its capacity.
+ * The returned view is valid until `scratch` is modified.
+ */
+template <typename Range, typename CharT>
+std::basic_string_view<CharT> make_contiguous_view_with_scratch(
+    Range&& range,
+    std::basic_string<CharT>& scratch)
+{
+    using value_t = ranges::range_value_t<Range>;
+    if constexpr (ranges::borrowed_range<Range> &&
+                  ranges::contiguous_range<Range> &&
+                  ranges::sized_range<Range>) {
+        return {ranges::data(range), ranges_polyfill::usize(range)};
+    }
+    else {
+        if constexpr (std::is_same_v<ranges::iterator_t<Range>,
+                                     typename detail::basic_scan_buffer<
+                                         value_t>::forward_iterator> &&
+                      ranges::common_range<Range>) {
+            auto beg_seg = range.begin().contiguous_segment();
+            auto end_seg = range.end().contiguous_segment();
+            if (SCN_LIKELY(detail::to_address(beg_seg.end()) ==
+                           detail::to_address(end_seg.end()))) {
+                return detail::make_string_view_from_pointers(
+                    beg_seg.data(), end_seg.data());
+            }
+        }
+
+        scratch.clear();
+        if constexpr (ranges::sized_range<Range>) {
+            scratch.reserve(ranges_polyfill::usize(range));
+        }
+        std::copy(ranges::begin(range), ranges::end(range),
+                  std::back_inserter(scratch));
+        return scratch;
+    }
+}
 }  // namespace impl
 
 SCN_END_NAMESPACE
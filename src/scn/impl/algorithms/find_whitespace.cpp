@@ -20,57 +20,588 @@
 #include <scn/impl/unicode/unicode_whitespace.h>
 #include <scn/impl/util/bits.h>
 
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SCN_HAS_FIND_WHITESPACE_SSE2 1
+#include <emmintrin.h>
+#else
+#define SCN_HAS_FIND_WHITESPACE_SSE2 0
+#endif
+
+// AVX2 is used if enabled at compile time, or with runtime dispatch when the
+// compiler supports per-function target attributes
+#if SCN_HAS_FIND_WHITESPACE_SSE2 && \
+    (defined(__AVX2__) || (SCN_GCC_COMPAT && !SCN_MSVC))
+#define SCN_HAS_FIND_WHITESPACE_AVX2 1
+#include <immintrin.h>
+#if defined(__AVX2__)
+#define SCN_FIND_WHITESPACE_TARGET_AVX2
+#else
+#define SCN_FIND_WHITESPACE_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#else
+#define SCN_HAS_FIND_WHITESPACE_AVX2 0
+#endif
+
 namespace scn {
 SCN_BEGIN_NAMESPACE
 
 namespace impl {
 namespace {
-template <typename R>
-bool has_nonascii_char_64(R source)
+/*
+ * Pattern_White_Space in UTF-8 is either a single ASCII byte
+ * (0x09-0x0d, 0x20), or one of these multi-byte sequences:
+ *  - U+0085:          C2 85
+ *  - U+200E, U+200F:  E2 80 8E, E2 80 8F
+ *  - U+2028, U+2029:  E2 80 A8, E2 80 A9
+ *
+ * The kernels below classify a block of bytes at once into ASCII spaces and
+ * possible lead bytes of these sequences (C2 and E2).
+ * Only the lead bytes need to be looked at more closely,
+ * every other non-ASCII byte is known not to be a part of a space,
+ * so no code points need to be decoded.
+ */
+
+/// Length of the multi-byte space starting at `p`, or 0 if there isn't one
+std::size_t multibyte_space_length(const char* p, const char* end)
 {
-    static_assert(sizeof(*source.data()) == 1);
-    SCN_EXPECT(source.size() <= 8);
-    uint64_t word{};
-    std::memcpy(&word, source.data(), source.size());
+    SCN_EXPECT(p < end);
+
+    const auto available = static_cast<std::size_t>(end - p);
+    const auto byte_at = [&](std::size_t i) {
+        return static_cast<unsigned char>(p[i]);
+    };
 
-    return has_byte_greater(word, 127) != 0;
+    if (byte_at(0) == 0xc2) {
+        return (available >= 2 && byte_at(1) == 0x85) ? 2 : 0;
+    }
+    if (byte_at(0) == 0xe2 && available >= 3 && byte_at(1) == 0x80) {
+        const auto b = byte_at(2);
+        if (b == 0x8e || b == 0x8f || b == 0xa8 || b == 0xa9) {
+            return 3;
+        }
+    }
+    return 0;
 }
 
-template <typename CuCb, typename CpCb>
-std::string_view::iterator find_classic_impl(std::string_view source,
-                                             CuCb cu_cb,
-                                             CpCb cp_cb)
+const char* find_classic_space_scalar(const char* p, const char* end)
 {
-    auto it = source.begin();
-
-    while (it != source.end()) {
-        auto sv =
-            detail::make_string_view_from_iterators<char>(it, source.end())
-                .substr(0, 8);
+    for (; p != end; ++p) {
+        if (is_ascii_space(*p) || multibyte_space_length(p, end) != 0) {
+            return p;
+        }
+    }
+    return end;
+}
 
-        if (!has_nonascii_char_64(sv)) {
-            auto tmp_it = ranges::find_if(sv, cu_cb);
-            it = detail::make_string_view_iterator(source, tmp_it);
-            if (tmp_it != sv.end()) {
-                break;
-            }
+const char* find_classic_nonspace_scalar(const char* p, const char* end)
+{
+    while (p != end) {
+        if (is_ascii_space(*p)) {
+            ++p;
             continue;
         }
+        const auto len = multibyte_space_length(p, end);
+        if (len == 0) {
+            return p;
+        }
+        p += len;
+    }
+    return end;
+}
+
+/**
+ * Bitmasks of a classified block, bit `i` corresponding to byte `i`:
+ * `space` is set for ASCII spaces, `lead` for C2 and E2.
+ */
+struct space_block_masks {
+    uint32_t space;
+    uint32_t lead;
+};
+
+/// Returns the first space in the block starting at `p`, or nullptr
+const char* find_space_in_block(const char* p,
+                                const char* end,
+                                space_block_masks masks)
+{
+    auto candidates = masks.space | masks.lead;
+    while (candidates != 0) {
+        const auto i = static_cast<std::size_t>(count_trailing_zeroes(
+            static_cast<uint64_t>(candidates)));
+        if ((masks.space >> i) & 1u ||
+            multibyte_space_length(p + i, end) != 0) {
+            return p + i;
+        }
+        candidates &= candidates - 1;
+    }
+    return nullptr;
+}
+
+/**
+ * Returns the first non-space in the block starting at `p`, or nullptr.
+ * In the latter case, `next` is set to where the search should continue,
+ * which may be past the end of the block,
+ * if a multi-byte space crosses the block boundary.
+ */
+const char* find_nonspace_in_block(const char* p,
+                                   const char* end,
+                                   space_block_masks masks,
+                                   std::size_t block_size,
+                                   const char*& next)
+{
+    const auto all_bits =
+        block_size == 32 ? ~uint32_t{0} : (uint32_t{1} << block_size) - 1;
+    auto nonspace = ~masks.space & all_bits;
+    while (nonspace != 0) {
+        const auto i = static_cast<std::size_t>(
+            count_trailing_zeroes(static_cast<uint64_t>(nonspace)));
+        if (((masks.lead >> i) & 1u) == 0) {
+            return p + i;
+        }
+        const auto len = multibyte_space_length(p + i, end);
+        if (len == 0) {
+            return p + i;
+        }
+        if (i + len >= block_size) {
+            next = p + i + len;
+            return nullptr;
+        }
+        nonspace &= ~(((uint32_t{1} << len) - 1) << i);
+    }
+    next = p + block_size;
+    return nullptr;
+}
+
+#if SCN_HAS_FIND_WHITESPACE_SSE2
+space_block_masks classify_space_block_sse2(const char* p)
+{
+    const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+    // 0x09 <= v <= 0x0d, as unsigned: (v - 0x09) <= 4
+    const auto shifted = _mm_sub_epi8(v, _mm_set1_epi8(0x09));
+    const auto is_control_space = _mm_cmpeq_epi8(
+        _mm_min_epu8(shifted, _mm_set1_epi8(0x04)), shifted);
+    const auto is_space = _mm_or_si128(
+        is_control_space, _mm_cmpeq_epi8(v, _mm_set1_epi8(0x20)));
+    const auto is_lead = _mm_or_si128(
+        _mm_cmpeq_epi8(v, _mm_set1_epi8(static_cast<char>(0xc2))),
+        _mm_cmpeq_epi8(v, _mm_set1_epi8(static_cast<char>(0xe2))));
+
+    return {static_cast<uint32_t>(_mm_movemask_epi8(is_space)),
+            static_cast<uint32_t>(_mm_movemask_epi8(is_lead))};
+}
+
+const char* find_classic_space_sse2(const char* p, const char* end)
+{
+    while (end - p >= 16) {
+        if (auto r = find_space_in_block(p, end, classify_space_block_sse2(p));
+            r) {
+            return r;
+        }
+        p += 16;
+    }
+    return find_classic_space_scalar(p, end);
+}
+
+const char* find_classic_nonspace_sse2(const char* p, const char* end)
+{
+    while (end - p >= 16) {
+        if (auto r = find_nonspace_in_block(
+                p, end, classify_space_block_sse2(p), 16, p);
+            r) {
+            return r;
+        }
+    }
+    return find_classic_nonspace_scalar(p, end);
+}
+#endif  // SCN_HAS_FIND_WHITESPACE_SSE2
+
+#if SCN_HAS_FIND_WHITESPACE_AVX2
+SCN_FIND_WHITESPACE_TARGET_AVX2
+space_block_masks classify_space_block_avx2(const char* p)
+{
+    // Classify by looking up both nibbles of every byte in a table,
+    // a byte belongs to a class if both lookups have the class bit set:
+    //   1: 0x09-0x0d (high nibble 0, low nibble 9-d)
+    //   2: 0x20 (high nibble 2, low nibble 0)
+    //   4: 0xc2, 0xe2 (high nibble c or e, low nibble 2)
+    const auto low_table =
+        _mm256_setr_epi8(2, 0, 4, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0,  //
+                         2, 0, 4, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0);
+    const auto high_table =
+        _mm256_setr_epi8(1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0,  //
+                         1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0);
+    const auto nibble_mask = _mm256_set1_epi8(0x0f);
+
+    const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const auto low = _mm256_and_si256(v, nibble_mask);
+    const auto high = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble_mask);
+    const auto classes =
+        _mm256_and_si256(_mm256_shuffle_epi8(low_table, low),
+                         _mm256_shuffle_epi8(high_table, high));
+
+    const auto zero = _mm256_setzero_si256();
+    const auto not_space = _mm256_cmpeq_epi8(
+        _mm256_and_si256(classes, _mm256_set1_epi8(3)), zero);
+    const auto not_lead = _mm256_cmpeq_epi8(
+        _mm256_and_si256(classes, _mm256_set1_epi8(4)), zero);
+
+    return {~static_cast<uint32_t>(_mm256_movemask_epi8(not_space)),
+            ~static_cast<uint32_t>(_mm256_movemask_epi8(not_lead))};
+}
+
+SCN_FIND_WHITESPACE_TARGET_AVX2
+const char* find_classic_space_avx2(const char* p, const char* end)
+{
+    while (end - p >= 32) {
+        if (auto r = find_space_in_block(p, end, classify_space_block_avx2(p));
+            r) {
+            return r;
+        }
+        p += 32;
+    }
+    return find_classic_space_sse2(p, end);
+}
+
+SCN_FIND_WHITESPACE_TARGET_AVX2
+const char* find_classic_nonspace_avx2(const char* p, const char* end)
+{
+    while (end - p >= 32) {
+        if (auto r = find_nonspace_in_block(
+                p, end, classify_space_block_avx2(p), 32, p);
+            r) {
+            return r;
+        }
+    }
+    return find_classic_nonspace_sse2(p, end);
+}
+#endif  // SCN_HAS_FIND_WHITESPACE_AVX2
+
+const char* find_nonascii_scalar(const char* p, const char* end)
+{
+    // Skip over whole words of ASCII, the high bit of every byte unset
+    for (; end - p >= 8; p += 8) {
+        uint64_t word{};
+        std::memcpy(&word, p, 8);
+        if ((word & 0x8080808080808080ull) != 0) {
+            break;
+        }
+    }
+    for (; p != end; ++p) {
+        if (!is_ascii_char(*p)) {
+            return p;
+        }
+    }
+    return end;
+}
+
+#if SCN_HAS_FIND_WHITESPACE_SSE2
+const char* find_nonascii_sse2(const char* p, const char* end)
+{
+    while (end - p >= 16) {
+        const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        if (const auto high = static_cast<uint32_t>(_mm_movemask_epi8(v));
+            high != 0) {
+            return p + count_trailing_zeroes(static_cast<uint64_t>(high));
+        }
+        p += 16;
+    }
+    return find_nonascii_scalar(p, end);
+}
+#endif  // SCN_HAS_FIND_WHITESPACE_SSE2
+
+#if SCN_HAS_FIND_WHITESPACE_AVX2
+SCN_FIND_WHITESPACE_TARGET_AVX2
+const char* find_nonascii_avx2(const char* p, const char* end)
+{
+    while (end - p >= 32) {
+        const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        if (const auto high = static_cast<uint32_t>(_mm256_movemask_epi8(v));
+            high != 0) {
+            return p + count_trailing_zeroes(static_cast<uint64_t>(high));
+        }
+        p += 32;
+    }
+    return find_nonascii_sse2(p, end);
+}
+#endif  // SCN_HAS_FIND_WHITESPACE_AVX2
+
+/*
+ * In UTF-16 and UTF-32, every Pattern_White_Space code point is encoded as a
+ * single code unit, and so are the decimal digits,
+ * so wide code units can be classified one at a time, without decoding.
+ * The SSE2 kernels classify a block of 16 bytes, 8 or 4 code units,
+ * depending on the size of wchar_t, into a mask with a bit per code unit.
+ */
+
+bool is_wide_classic_space(wchar_t ch)
+{
+    const auto cu = static_cast<uint32_t>(ch);
+    return (cu - 0x09u) <= 4u || cu == 0x20 || cu == 0x85 ||
+           (cu | 1u) == 0x200f ||  // U+200E, U+200F
+           (cu | 1u) == 0x2029;    // U+2028, U+2029
+}
+
+bool is_wide_decimal_digit(wchar_t ch)
+{
+    return (static_cast<uint32_t>(ch) - uint32_t{'0'}) <= 9u;
+}
+
+template <bool Member, typename Predicate>
+const wchar_t* find_wide_scalar(const wchar_t* p,
+                                const wchar_t* end,
+                                Predicate pred)
+{
+    for (; p != end; ++p) {
+        if (pred(*p) == Member) {
+            return p;
+        }
+    }
+    return end;
+}
+
+#if SCN_HAS_FIND_WHITESPACE_SSE2
+constexpr std::ptrdiff_t wide_block_size = 16 / sizeof(wchar_t);
+
+/// Bit `i` of the result is set, if code unit `i` of the block is set in `v`
+uint32_t wide_block_movemask_sse2(__m128i v)
+{
+    if constexpr (sizeof(wchar_t) == 2) {
+        return static_cast<uint32_t>(
+            _mm_movemask_epi8(_mm_packs_epi16(v, _mm_setzero_si128())));
+    }
+    else {
+        return static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(v)));
+    }
+}
+
+__m128i wide_set1_sse2(int value)
+{
+    if constexpr (sizeof(wchar_t) == 2) {
+        return _mm_set1_epi16(static_cast<short>(value));
+    }
+    else {
+        return _mm_set1_epi32(value);
+    }
+}
+
+/// `lo <= v < lo + n`, as unsigned, for every code unit of `v`
+__m128i wide_in_range_sse2(__m128i v, int lo, int n)
+{
+    if constexpr (sizeof(wchar_t) == 2) {
+        const auto shifted = _mm_sub_epi16(v, wide_set1_sse2(lo));
+        return _mm_cmpeq_epi16(_mm_subs_epu16(shifted, wide_set1_sse2(n - 1)),
+                               _mm_setzero_si128());
+    }
+    else {
+        // No unsigned comparisons for 32-bit lanes,
+        // code units below `lo` wrap around to negative values
+        const auto shifted = _mm_sub_epi32(v, wide_set1_sse2(lo));
+        return _mm_andnot_si128(_mm_cmplt_epi32(shifted, _mm_setzero_si128()),
+                                _mm_cmplt_epi32(shifted, wide_set1_sse2(n)));
+    }
+}
+
+__m128i wide_equal_sse2(__m128i v, int value)
+{
+    if constexpr (sizeof(wchar_t) == 2) {
+        return _mm_cmpeq_epi16(v, wide_set1_sse2(value));
+    }
+    else {
+        return _mm_cmpeq_epi32(v, wide_set1_sse2(value));
+    }
+}
+
+uint32_t classify_wide_space_block_sse2(const wchar_t* p)
+{
+    const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    // U+200E and U+200F, as well as U+2028 and U+2029,
+    // only differ in their lowest bit
+    const auto paired = _mm_or_si128(v, wide_set1_sse2(1));
+    const auto is_space = _mm_or_si128(
+        _mm_or_si128(wide_in_range_sse2(v, 0x09, 5), wide_equal_sse2(v, 0x20)),
+        _mm_or_si128(_mm_or_si128(wide_equal_sse2(v, 0x85),
+                                  wide_equal_sse2(paired, 0x200f)),
+                     wide_equal_sse2(paired, 0x2029)));
+    return wide_block_movemask_sse2(is_space);
+}
+
+uint32_t classify_wide_digit_block_sse2(const wchar_t* p)
+{
+    const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    return wide_block_movemask_sse2(wide_in_range_sse2(v, '0', 10));
+}
+
+/**
+ * Returns the first code unit in `[p, end)` that's (`Member`)
+ * or isn't (`!Member`) classified by `classify`.
+ * Whatever is left after the last whole block is searched with `pred`.
+ */
+template <bool Member, typename ClassifyBlock, typename Predicate>
+const wchar_t* find_wide_sse2(const wchar_t* p,
+                              const wchar_t* end,
+                              ClassifyBlock classify,
+                              Predicate pred)
+{
+    constexpr auto all_bits = (uint32_t{1} << wide_block_size) - 1;
+    while (end - p >= wide_block_size) {
+        auto mask = classify(p);
+        if constexpr (!Member) {
+            mask = ~mask & all_bits;
+        }
+        if (mask != 0) {
+            return p + count_trailing_zeroes(static_cast<uint64_t>(mask));
+        }
+        p += wide_block_size;
+    }
+    return find_wide_scalar<Member>(p, end, pred);
+}
+#endif  // SCN_HAS_FIND_WHITESPACE_SSE2
+
+template <bool Member>
+const wchar_t* find_wide_classic_space(const wchar_t* p, const wchar_t* end)
+{
+#if SCN_HAS_FIND_WHITESPACE_SSE2
+    return find_wide_sse2<Member>(p, end, classify_wide_space_block_sse2,
+                                  is_wide_classic_space);
+#else
+    return find_wide_scalar<Member>(p, end, is_wide_classic_space);
+#endif
+}
+
+const wchar_t* find_wide_nondecimal_digit(const wchar_t* p,
+                                          const wchar_t* end)
+{
+#if SCN_HAS_FIND_WHITESPACE_SSE2
+    return find_wide_sse2<false>(p, end, classify_wide_digit_block_sse2,
+                                 is_wide_decimal_digit);
+#else
+    return find_wide_scalar<false>(p, end, is_wide_decimal_digit);
+#endif
+}
+
+/*
+ * Searching for a set of ASCII characters is done by splitting every byte
+ * into its high and low nibble. A 16-entry table, indexed by the low nibble,
+ * holds the set of high nibbles forming a member with that low nibble,
+ * as a bitmask. The bit of the high nibble is looked up from another table,
+ * which has no bits set for the high nibbles of non-ASCII bytes.
+ * Both of these lookups can be done for a whole block with a byte shuffle.
+ */
 
-        for (size_t i = 0; i < sv.size(); ++i) {
-            auto tmp =
-                detail::make_string_view_from_iterators<char>(it, source.end());
-            auto res = get_next_code_point(tmp);
-            if (cp_cb(res.value)) {
-                return it;
-            }
-            i += ranges::distance(tmp.data(), detail::to_address(res.iterator));
-            it = detail::make_string_view_iterator(source, res.iterator);
-            SCN_ENSURE(it <= source.end());
+bool is_ascii_charset_member(char ch, const ascii_charset_bitmap& charset)
+{
+    const auto val = static_cast<unsigned char>(ch);
+    return val < 128 && ((charset[val / 8] >> (val % 8)) & 1u) != 0;
+}
+
+/// Returns the first code unit with membership equal to `member`
+const char* find_ascii_charset_scalar(const char* p,
+                                      const char* end,
+                                      const ascii_charset_bitmap& charset,
+                                      bool member)
+{
+    for (; p != end; ++p) {
+        if (is_ascii_charset_member(*p, charset) == member) {
+            return p;
         }
     }
+    return end;
+}
 
-    return detail::make_string_view_iterator(source, it);
+#if SCN_HAS_FIND_WHITESPACE_AVX2
+std::array<uint8_t, 16> make_ascii_charset_nibble_table(
+    const ascii_charset_bitmap& charset)
+{
+    std::array<uint8_t, 16> table{};
+    for (unsigned ch = 0; ch < 128; ++ch) {
+        if (((charset[ch / 8] >> (ch % 8)) & 1u) != 0) {
+            table[ch & 0x0f] |= static_cast<uint8_t>(1u << (ch >> 4));
+        }
+    }
+    return table;
+}
+
+SCN_FIND_WHITESPACE_TARGET_AVX2
+uint32_t classify_ascii_charset_block_avx2(const char* p, __m256i table)
+{
+    const auto bit_table = _mm256_setr_epi8(
+        1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0,  //
+        1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+    const auto nibble_mask = _mm256_set1_epi8(0x0f);
+
+    const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const auto low = _mm256_and_si256(v, nibble_mask);
+    const auto high = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble_mask);
+    const auto is_member = _mm256_and_si256(
+        _mm256_shuffle_epi8(table, low), _mm256_shuffle_epi8(bit_table, high));
+
+    const auto not_member =
+        _mm256_cmpeq_epi8(is_member, _mm256_setzero_si256());
+    return ~static_cast<uint32_t>(_mm256_movemask_epi8(not_member));
+}
+
+SCN_FIND_WHITESPACE_TARGET_AVX2
+const char* find_ascii_charset_avx2(const char* p,
+                                    const char* end,
+                                    const ascii_charset_bitmap& charset,
+                                    bool member)
+{
+    const auto nibble_table = make_ascii_charset_nibble_table(charset);
+    const auto table = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(nibble_table.data())));
+    const auto flip = member ? uint32_t{0} : ~uint32_t{0};
+
+    while (end - p >= 32) {
+        const auto hits = classify_ascii_charset_block_avx2(p, table) ^ flip;
+        if (hits != 0) {
+            return p + count_trailing_zeroes(static_cast<uint64_t>(hits));
+        }
+        p += 32;
+    }
+    return find_ascii_charset_scalar(p, end, charset, member);
+}
+#endif  // SCN_HAS_FIND_WHITESPACE_AVX2
+
+struct find_classic_kernels {
+    const char* (*find_space)(const char*, const char*);
+    const char* (*find_nonspace)(const char*, const char*);
+    const char* (*find_ascii_charset)(const char*,
+                                      const char*,
+                                      const ascii_charset_bitmap&,
+                                      bool);
+    const char* (*find_nonascii)(const char*, const char*);
+};
+
+find_classic_kernels select_find_classic_kernels()
+{
+#if SCN_HAS_FIND_WHITESPACE_AVX2
+#if defined(__AVX2__)
+    return {find_classic_space_avx2, find_classic_nonspace_avx2,
+            find_ascii_charset_avx2, find_nonascii_avx2};
+#else
+    if (__builtin_cpu_supports("avx2")) {
+        return {find_classic_space_avx2, find_classic_nonspace_avx2,
+                find_ascii_charset_avx2, find_nonascii_avx2};
+    }
+    return {find_classic_space_sse2, find_classic_nonspace_sse2,
+            find_ascii_charset_scalar, find_nonascii_sse2};
+#endif
+#elif SCN_HAS_FIND_WHITESPACE_SSE2
+    return {find_classic_space_sse2, find_classic_nonspace_sse2,
+            find_ascii_charset_scalar, find_nonascii_sse2};
+#else
+    return {find_classic_space_scalar, find_classic_nonspace_scalar,
+            find_ascii_charset_scalar, find_nonascii_scalar};
+#endif
+}
+
+const find_classic_kernels& get_find_classic_kernels()
+{
+    static const find_classic_kernels kernels = select_find_classic_kernels();
+    return kernels;
 }
 
 bool is_decimal_digit(char ch) SCN_NOEXCEPT
@@ -112,22 +643,42 @@ std::string_view::iterator find_nondecimal_digit_simple_impl(
     return ranges::find_if(
         source, [](char ch) SCN_NOEXCEPT { return !is_decimal_digit(ch); });
 }
+
+std::string_view::iterator find_ascii_charset_impl(
+    std::string_view source,
+    const ascii_charset_bitmap& charset,
+    bool member)
+{
+    // Look at the beginning first, so that short tokens don't need to pay for
+    // setting up the vectorized search
+    constexpr std::size_t scalar_prefix_size = 16;
+    const auto end = source.data() + source.size();
+    const auto prefix_end =
+        source.data() + (std::min)(source.size(), scalar_prefix_size);
+    auto p = find_ascii_charset_scalar(source.data(), prefix_end, charset,
+                                       member);
+    if (p == prefix_end) {
+        p = get_find_classic_kernels().find_ascii_charset(prefix_end, end,
+                                                          charset, member);
+    }
+    return detail::make_string_view_iterator_from_pointer(source, p);
+}
 }  // namespace
 
 std::string_view::iterator find_classic_space_narrow_fast(
     std::string_view source)
 {
-    return find_classic_impl(
-        source, [](char ch) { return is_ascii_space(ch); },
-        [](char32_t cp) { return is_cp_space(cp); });
+    const auto end = source.data() + source.size();
+    return detail::make_string_view_iterator_from_pointer(
+        source, get_find_classic_kernels().find_space(source.data(), end));
 }
 
 std::string_view::iterator find_classic_nonspace_narrow_fast(
     std::string_view source)
 {
-    return find_classic_impl(
-        source, [](char ch) { return !is_ascii_space(ch); },
-        [](char32_t cp) { return !is_cp_space(cp); });
+    const auto end = source.data() + source.size();
+    return detail::make_string_view_iterator_from_pointer(
+        source, get_find_classic_kernels().find_nonspace(source.data(), end));
 }
 
 std::string_view::iterator find_nondecimal_digit_narrow_fast(
@@ -135,6 +686,51 @@ std::string_view::iterator find_nondecimal_digit_narrow_fast(
 {
     return find_nondecimal_digit_simple_impl(source);
 }
+
+std::string_view::iterator find_nonascii_narrow_fast(std::string_view source)
+{
+    const auto end = source.data() + source.size();
+    return detail::make_string_view_iterator_from_pointer(
+        source, get_find_classic_kernels().find_nonascii(source.data(), end));
+}
+
+std::wstring_view::iterator find_classic_space_wide_fast(
+    std::wstring_view source)
+{
+    const auto end = source.data() + source.size();
+    return detail::make_string_view_iterator_from_pointer(
+        source, find_wide_classic_space<true>(source.data(), end));
+}
+
+std::wstring_view::iterator find_classic_nonspace_wide_fast(
+    std::wstring_view source)
+{
+    const auto end = source.data() + source.size();
+    return detail::make_string_view_iterator_from_pointer(
+        source, find_wide_classic_space<false>(source.data(), end));
+}
+
+std::wstring_view::iterator find_nondecimal_digit_wide_fast(
+    std::wstring_view source)
+{
+    const auto end = source.data() + source.size();
+    return detail::make_string_view_iterator_from_pointer(
+        source, find_wide_nondecimal_digit(source.data(), end));
+}
+
+std::string_view::iterator find_ascii_charset_member_narrow_fast(
+    std::string_view source,
+    const ascii_charset_bitmap& charset)
+{
+    return find_ascii_charset_impl(source, charset, true);
+}
+
+std::string_view::iterator find_ascii_charset_nonmember_narrow_fast(
+    std::string_view source,
+    const ascii_charset_bitmap& charset)
+{
+    return find_ascii_charset_impl(source, charset, false);
+}
 }  // namespace impl
 
 SCN_END_NAMESPACE
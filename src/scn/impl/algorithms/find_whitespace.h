@@ -19,6 +19,9 @@
 
 #include <scn/util/string_view.h>
 
+#include <array>
+#include <cstdint>
+
 namespace scn {
 SCN_BEGIN_NAMESPACE
 
@@ -31,6 +34,59 @@ std::string_view::iterator find_classic_nonspace_narrow_fast(
 
 std::string_view::iterator find_nondecimal_digit_narrow_fast(
     std::string_view source);
+
+std::wstring_view::iterator find_classic_space_wide_fast(
+    std::wstring_view source);
+
+std::wstring_view::iterator find_classic_nonspace_wide_fast(
+    std::wstring_view source);
+
+std::wstring_view::iterator find_nondecimal_digit_wide_fast(
+    std::wstring_view source);
+
+/// `find_classic_space_narrow_fast` or `find_classic_space_wide_fast`
+template <typename CharT>
+auto find_classic_space_fast(std::basic_string_view<CharT> source)
+{
+    if constexpr (std::is_same_v<CharT, char>) {
+        return find_classic_space_narrow_fast(source);
+    }
+    else {
+        return find_classic_space_wide_fast(source);
+    }
+}
+
+/// `find_classic_nonspace_narrow_fast` or `find_classic_nonspace_wide_fast`
+template <typename CharT>
+auto find_classic_nonspace_fast(std::basic_string_view<CharT> source)
+{
+    if constexpr (std::is_same_v<CharT, char>) {
+        return find_classic_nonspace_narrow_fast(source);
+    }
+    else {
+        return find_classic_nonspace_wide_fast(source);
+    }
+}
+
+/// Returns the first code unit that's not ASCII (has its high bit set)
+std::string_view::iterator find_nonascii_narrow_fast(std::string_view source);
+
+/**
+ * Set of ASCII characters, bit `ch % 8` of `bits[ch / 8]` is set,
+ * if `ch` is a member. Same layout as `format_specs::charset_literals`.
+ */
+using ascii_charset_bitmap = std::array<uint8_t, 128 / 8>;
+
+/// Returns the first code unit that's a member of `charset`
+std::string_view::iterator find_ascii_charset_member_narrow_fast(
+    std::string_view source,
+    const ascii_charset_bitmap& charset);
+
+/// Returns the first code unit that's not a member of `charset`.
+/// Non-ASCII code units are never members.
+std::string_view::iterator find_ascii_charset_nonmember_narrow_fast(
+    std::string_view source,
+    const ascii_charset_bitmap& charset);
 }  // namespace impl
 
 SCN_END_NAMESPACE
@@ -25,6 +25,7 @@
 #include <scn/impl/unicode/unicode.h>
 #include <scn/impl/unicode/unicode_whitespace.h>
 #include <scn/impl/util/function_ref.h>
+#include <scn/impl/util/text_width.h>
 #include <scn/util/span.h>
 
 #include <algorithm>
@@ -108,7 +109,33 @@ simple_borrowed_iterator_t<Range> read_exactly_n_width_units(
     auto it = ranges::begin(range);
     ranges::range_difference_t<Range> acc_width = 0;
 
-    while (it != ranges::end(range)) {
+    // Every code point has a width of at least 1,
+    // so nothing more fits after reaching `count`
+    while (it != ranges::end(range) && acc_width < count) {
+        if constexpr (ranges::contiguous_range<Range> &&
+                      ranges::sized_range<Range> &&
+                      std::is_same_v<detail::char_t<Range>, char>) {
+            // ASCII code points have a width of 1:
+            // take as many of them as there's width left in one go
+            const auto rest = detail::make_string_view_from_pointers(
+                detail::to_address(it), detail::to_address(ranges::end(range)));
+            const auto width_left = static_cast<std::size_t>(count - acc_width);
+            const auto ascii_end = find_nonascii_narrow_fast(
+                rest.substr(0, width_left));
+            const auto ascii_run = detail::to_address(ascii_end) - rest.data();
+            it += ascii_run;
+            acc_width += ascii_run;
+            if (it == ranges::end(range) || acc_width == count ||
+                is_ascii_char(*it)) {
+                continue;
+            }
+        }
+        else if (is_ascii_char(*it)) {
+            ++it;
+            ++acc_width;
+            continue;
+        }
+
         auto [iter, val] =
             read_code_point_into(ranges::subrange{it, ranges::end(range)});
 
@@ -268,25 +295,21 @@ template <typename Range>
 simple_borrowed_iterator_t<Range> read_until_classic_space(Range&& range)
 {
     if constexpr (ranges::contiguous_range<Range> &&
-                  ranges::sized_range<Range> &&
-                  std::is_same_v<detail::char_t<Range>, char>) {
+                  ranges::sized_range<Range>) {
         auto buf = make_contiguous_buffer(SCN_FWD(range));
-        auto it = find_classic_space_narrow_fast(buf.view());
+        auto it = find_classic_space_fast(buf.view());
         return ranges::next(ranges::begin(range),
                             ranges::distance(buf.view().begin(), it));
     }
     else {
         auto it = ranges::begin(range);
 
-        if constexpr (std::is_same_v<detail::char_t<Range>, char>) {
-            auto seg = get_contiguous_beginning(range);
-            if (auto seg_it = find_classic_space_narrow_fast(seg);
-                seg_it != seg.end()) {
-                return ranges_polyfill::batch_next(
-                    it, ranges::distance(seg.begin(), seg_it));
-            }
-            ranges_polyfill::batch_next(it, seg.size());
+        auto seg = get_contiguous_beginning(range);
+        if (auto seg_it = find_classic_space_fast(seg); seg_it != seg.end()) {
+            return ranges_polyfill::batch_next(
+                it, ranges::distance(seg.begin(), seg_it));
         }
+        ranges_polyfill::batch_next(it, seg.size());
 
         return read_until_code_point(
             ranges::subrange{it, ranges::end(range)},
@@ -298,25 +321,22 @@ template <typename Range>
 simple_borrowed_iterator_t<Range> read_while_classic_space(Range&& range)
 {
     if constexpr (ranges::contiguous_range<Range> &&
-                  ranges::sized_range<Range> &&
-                  std::is_same_v<detail::char_t<Range>, char>) {
+                  ranges::sized_range<Range>) {
         auto buf = make_contiguous_buffer(SCN_FWD(range));
-        auto it = find_classic_nonspace_narrow_fast(buf.view());
+        auto it = find_classic_nonspace_fast(buf.view());
         return ranges::next(ranges::begin(range),
                             ranges::distance(buf.view().begin(), it));
     }
     else {
         auto it = ranges::begin(range);
 
-        if constexpr (std::is_same_v<detail::char_t<Range>, char>) {
-            auto seg = get_contiguous_beginning(range);
-            if (auto seg_it = find_classic_nonspace_narrow_fast(seg);
-                seg_it != seg.end()) {
-                return ranges_polyfill::batch_next(
-                    it, ranges::distance(seg.begin(), seg_it));
-            }
-            ranges_polyfill::batch_next(it, seg.size());
+        auto seg = get_contiguous_beginning(range);
+        if (auto seg_it = find_classic_nonspace_fast(seg);
+            seg_it != seg.end()) {
+            return ranges_polyfill::batch_next(
+                it, ranges::distance(seg.begin(), seg_it));
         }
+        ranges_polyfill::batch_next(it, seg.size());
 
         return read_while_code_point(
             SCN_FWD(range),
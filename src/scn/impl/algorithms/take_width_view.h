@@ -93,6 +93,24 @@ public:
         return m_multibyte_left;
     }
 
+    /**
+     * `true`, if the code point at the current position doesn't fit into
+     * the width left, or if there's no width left at all.
+     */
+    bool is_width_exhausted() const
+    {
+        if (m_multibyte_left != 0) {
+            return false;
+        }
+        if (m_count <= 0) {
+            return true;
+        }
+        // Code points are at most 2 wide
+        return m_count == 1 && m_current != m_end &&
+               _get_width_at_current_cp_start(_get_cp_length_at_current()) >
+                   1;
+    }
+
     constexpr decltype(auto) operator*()
     {
         return *m_current;
@@ -206,12 +224,12 @@ public:
     friend constexpr bool operator==(const counted_width_iterator& x,
                                      ranges_std::default_sentinel_t)
     {
-        return x.count() == 0 && x.multibyte_left() == 0;
+        return x.is_width_exhausted();
     }
     friend constexpr bool operator==(ranges_std::default_sentinel_t,
                                      const counted_width_iterator& x)
     {
-        return x.count() == 0 && x.multibyte_left() == 0;
+        return x.is_width_exhausted();
     }
 
     friend constexpr bool operator!=(const counted_width_iterator& a,
@@ -433,8 +451,7 @@ class take_width_view : public ranges::view_interface<take_width_view<View>> {
 
         friend constexpr bool operator==(const CWI& y, const sentinel& x)
         {
-            return (y.count() == 0 && y.multibyte_left() == 0) ||
-                   y.base() == x.m_end;
+            return y.base() == x.m_end || y.is_width_exhausted();
         }
 
         friend constexpr bool operator==(const sentinel& x, const CWI& y)
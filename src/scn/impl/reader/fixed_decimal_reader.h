@@ -0,0 +1,191 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#pragma once
+
+#include <scn/detail/fixed_decimal.h>
+#include <scn/impl/reader/integer_reader.h>
+
+#include <algorithm>
+#include <array>
+
+namespace scn {
+SCN_BEGIN_NAMESPACE
+
+namespace impl {
+inline constexpr std::array<uint64_t, 20> fixed_decimal_pow10_table = {
+    1ull,
+    10ull,
+    100ull,
+    1'000ull,
+    10'000ull,
+    100'000ull,
+    1'000'000ull,
+    10'000'000ull,
+    100'000'000ull,
+    1'000'000'000ull,
+    10'000'000'000ull,
+    100'000'000'000ull,
+    1'000'000'000'000ull,
+    10'000'000'000'000ull,
+    100'000'000'000'000ull,
+    1'000'000'000'000'000ull,
+    10'000'000'000'000'000ull,
+    100'000'000'000'000'000ull,
+    1'000'000'000'000'000'000ull,
+    10'000'000'000'000'000'000ull};
+
+template <typename CharT>
+bool fixed_decimal_round_up(std::basic_string_view<CharT> dropped_digits,
+                            uint64_t magnitude,
+                            fixed_decimal_rounding rounding)
+{
+    SCN_EXPECT(!dropped_digits.empty());
+
+    const auto first = char_to_int(dropped_digits.front());
+    switch (rounding) {
+        case fixed_decimal_rounding::toward_zero:
+            return false;
+
+        case fixed_decimal_rounding::to_nearest_away_from_zero:
+            return first >= 5;
+
+        case fixed_decimal_rounding::to_nearest_even: {
+            if (first != 5) {
+                return first > 5;
+            }
+            const bool is_exactly_half = std::all_of(
+                dropped_digits.begin() + 1, dropped_digits.end(),
+                [](CharT ch) { return ch == CharT{'0'}; });
+            return !is_exactly_half || (magnitude & 1) != 0;
+        }
+    }
+
+    SCN_EXPECT(false);
+    SCN_UNREACHABLE;
+}
+
+/**
+ * Combines the integral and fractional digits of a fixed-point number into
+ * a single value, scaled by `10^scale`.
+ * Both parts are parsed with `parse_integer_value`.
+ */
+template <typename CharT>
+scan_expected<uint64_t> parse_fixed_decimal_digits(
+    std::basic_string_view<CharT> integer_digits,
+    std::basic_string_view<CharT> fraction_digits,
+    unsigned scale,
+    fixed_decimal_rounding rounding)
+{
+    SCN_EXPECT(scale < fixed_decimal_pow10_table.size());
+
+    unsigned long long integer_part{0};
+    if (!integer_digits.empty()) {
+        if (auto r = parse_integer_value(integer_digits, integer_part,
+                                         sign_type::plus_sign, 10);
+            SCN_UNLIKELY(!r)) {
+            return unexpected(r.error());
+        }
+    }
+
+    const auto kept_digits = std::min(static_cast<std::size_t>(scale),
+                                      fraction_digits.size());
+    unsigned long long fraction_part{0};
+    if (kept_digits != 0) {
+        if (auto r = parse_integer_value(fraction_digits.substr(0, kept_digits),
+                                         fraction_part, sign_type::plus_sign,
+                                         10);
+            SCN_UNLIKELY(!r)) {
+            return unexpected(r.error());
+        }
+        fraction_part *= fixed_decimal_pow10_table[scale - kept_digits];
+    }
+
+    constexpr auto max = std::numeric_limits<uint64_t>::max();
+    const auto multiplier = fixed_decimal_pow10_table[scale];
+    if (SCN_UNLIKELY(integer_part > (max - fraction_part) / multiplier)) {
+        return unexpected_scan_error(scan_error::value_out_of_range,
+                                     "Scanned fixed_decimal out of range");
+    }
+    uint64_t magnitude = integer_part * multiplier + fraction_part;
+
+    if (kept_digits < fraction_digits.size() &&
+        fixed_decimal_round_up(fraction_digits.substr(kept_digits), magnitude,
+                               rounding)) {
+        if (SCN_UNLIKELY(magnitude == max)) {
+            return unexpected_scan_error(scan_error::value_out_of_range,
+                                         "Scanned fixed_decimal out of range");
+        }
+        ++magnitude;
+    }
+
+    return magnitude;
+}
+
+template <typename Range>
+auto read_fixed_decimal_magnitude(Range range,
+                                  unsigned scale,
+                                  fixed_decimal_rounding rounding,
+                                  uint64_t& magnitude,
+                                  bool& is_negative)
+    -> scan_expected<ranges::iterator_t<Range>>
+{
+    using char_type = detail::char_t<Range>;
+    const auto is_digit = [](char_type ch)
+                              SCN_NOEXCEPT { return char_to_int(ch) < 10; };
+
+    SCN_TRY(it, skip_classic_whitespace(range).transform_error(
+                    make_eof_scan_error));
+    SCN_TRY(sign_result,
+            parse_numeric_sign(ranges::subrange{it, ranges::end(range)})
+                .transform_error(make_eof_scan_error));
+    it = sign_result.first;
+    is_negative = sign_result.second == sign_type::minus_sign;
+
+    const auto integer_end = read_while_code_unit(
+        ranges::subrange{it, ranges::end(range)}, is_digit);
+    auto integer_buf =
+        make_contiguous_buffer(ranges::subrange{it, integer_end});
+
+    auto fraction_begin = integer_end;
+    auto fraction_end = integer_end;
+    if (auto point_it = read_matching_code_unit(
+            ranges::subrange{integer_end, ranges::end(range)}, '.')) {
+        fraction_begin = *point_it;
+        fraction_end = read_while_code_unit(
+            ranges::subrange{fraction_begin, ranges::end(range)}, is_digit);
+    }
+    auto fraction_buf =
+        make_contiguous_buffer(ranges::subrange{fraction_begin, fraction_end});
+
+    if (SCN_UNLIKELY(integer_buf.view().empty() &&
+                     fraction_buf.view().empty())) {
+        return unexpected_scan_error(
+            scan_error::invalid_scanned_value,
+            "Failed to parse fixed_decimal: No digits found");
+    }
+
+    SCN_TRY_ASSIGN(magnitude,
+                   parse_fixed_decimal_digits(integer_buf.view(),
+                                              fraction_buf.view(), scale,
+                                              rounding));
+    return fraction_end;
+}
+}  // namespace impl
+
+SCN_END_NAMESPACE
+}  // namespace scn
@@ -17,6 +17,7 @@
 
 #include <scn/impl/reader/float_reader.h>
 #include <scn/impl/reader/integer_reader.h>
+#include <scn/impl/util/bits.h>
 
 SCN_GCC_PUSH
 SCN_GCC_IGNORE("-Wold-style-cast")
@@ -48,6 +49,8 @@ SCN_CLANG_IGNORE("-Wreserved-identifier")
 SCN_CLANG_POP
 SCN_GCC_POP
 
+#include <algorithm>
+#include <array>
 #include <clocale>
 #include <limits>
 #include <sstream>
@@ -79,6 +82,14 @@ SCN_GCC_POP
 #if !((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ > 25)))
 #include <xlocale.h>
 #define SCN_XLOCALE SCN_XLOCALE_POSIX
+
+#elif defined(__USE_GNU)
+// glibc >= 2.26 doesn't have <xlocale.h>:
+// locale_t and the *_l functions are in <locale.h> and <stdlib.h>
+#include <locale.h>
+#include <stdlib.h>
+#include <wchar.h>
+#define SCN_XLOCALE SCN_XLOCALE_POSIX
 #endif  // __GLIBC__ <= 2.25
 
 #elif defined(__FreeBSD_version) && __FreeBSD_version >= 1000010
@@ -330,6 +341,40 @@ private:
 
     contiguous_range_factory<CharT>& m_input;
 };
+
+template <typename T>
+class strtod_buffer_impl : public strtod_impl_base<T> {
+public:
+    explicit strtod_buffer_impl(impl_base base) : strtod_impl_base<T>(base) {}
+
+    // `source` must only contain the characters of a decimal float value,
+    // already validated by the caller.
+    // Values shorter than 64 characters are null-terminated in a stack
+    // buffer, so that no allocation is made. Longer ones allocate.
+    template <typename CharT>
+    scan_expected<std::ptrdiff_t> operator()(
+        T& value,
+        std::basic_string_view<CharT> source)
+    {
+        std::array<char, 64> stack_buffer{};
+        std::string heap_buffer{};
+        char* buffer = stack_buffer.data();
+        if (source.size() >= stack_buffer.size()) {
+            SCN_UNLIKELY_ATTR
+            // This allocates: the digits can't be cut short,
+            // because a correctly rounded result may depend on all of them
+            heap_buffer.resize(source.size() + 1);
+            buffer = heap_buffer.data();
+        }
+
+        std::transform(source.begin(), source.end(), buffer,
+                       [](CharT ch) { return static_cast<char>(ch); });
+        buffer[source.size()] = '\0';
+
+        return this->parse(value, static_cast<const char*>(buffer),
+                           strtod_impl_base<T>::generic_narrow_strtod);
+    }
+};
 #endif
 
 ////////////////////////////////////////////////////////////////////
@@ -447,6 +492,445 @@ public:
 };
 #endif  // SCN_HAS_FLOAT_CHARCONV && !SCN_DISABLE_FROM_CHARS
 
+////////////////////////////////////////////////////////////////////
+// Native hexfloat implementation
+// For all CharT, and FloatT with at most 64 bits of mantissa
+////////////////////////////////////////////////////////////////////
+
+template <typename T>
+inline constexpr bool has_native_hexfloat_impl =
+    std::numeric_limits<T>::radix == 2 && std::numeric_limits<T>::digits <= 64;
+
+template <typename CharT, typename T>
+class hexfloat_impl : impl_base {
+public:
+    explicit hexfloat_impl(impl_init_data<CharT> data)
+        : impl_base{data.base()}, m_input(data.input)
+    {
+    }
+
+    scan_expected<std::ptrdiff_t> operator()(T& value) const
+    {
+        auto input = m_input.view();
+        std::ptrdiff_t prefix_len = 0;
+        if (m_kind == float_reader_base::float_kind::hex_with_prefix) {
+            if (SCN_UNLIKELY((m_options & float_reader_base::allow_hex) ==
+                             0)) {
+                return unexpected_scan_error(
+                    scan_error::invalid_scanned_value,
+                    "Hexfloats disallowed by format string");
+            }
+            SCN_EXPECT(input.size() >= 2);
+            input = input.substr(2);
+            prefix_len = 2;
+        }
+
+        significand sig{};
+        auto it = read_significand(input, sig);
+        if (SCN_UNLIKELY(sig.digits_count == 0)) {
+            return unexpected_scan_error(scan_error::invalid_scanned_value,
+                                         "No significand digits in hexfloat");
+        }
+        it = read_exponent(it, input.end(), sig.exponent);
+
+        if (auto e = make_float(sig, value); SCN_UNLIKELY(!e)) {
+            return unexpected(e);
+        }
+        return prefix_len + ranges::distance(input.begin(), it);
+    }
+
+private:
+    using iterator = typename std::basic_string_view<CharT>::iterator;
+
+    // Parsed significand: the value is
+    // (mantissa * 16 + extra_digit) * 2^exponent, if has_extra_digit, and
+    // mantissa * 2^exponent otherwise.
+    // sticky is set, if nonzero digits were dropped after extra_digit.
+    struct significand {
+        uint64_t mantissa{0};
+        unsigned extra_digit{0};
+        bool has_extra_digit{false};
+        bool sticky{false};
+        std::ptrdiff_t exponent{0};
+        std::ptrdiff_t digits_count{0};
+    };
+
+    // Saturation point for the binary exponent,
+    // well beyond the range of any supported floating-point type
+    static constexpr std::ptrdiff_t max_exponent_magnitude = 1 << 24;
+
+    static iterator read_significand(std::basic_string_view<CharT> input,
+                                     significand& sig)
+    {
+        auto it = input.begin();
+        bool is_fractional = false;
+        for (; it != input.end(); ++it) {
+            if (*it == CharT{'.'} && !is_fractional) {
+                is_fractional = true;
+                continue;
+            }
+
+            const auto digit = char_to_int(*it);
+            if (digit >= 16) {
+                break;
+            }
+            ++sig.digits_count;
+
+            if (sig.mantissa == 0 && digit == 0) {
+                // Leading zero
+                if (is_fractional) {
+                    sig.exponent -= 4;
+                }
+            }
+            else if ((sig.mantissa >> 60) == 0) {
+                sig.mantissa = (sig.mantissa << 4) | digit;
+                if (is_fractional) {
+                    sig.exponent -= 4;
+                }
+            }
+            else if (!sig.has_extra_digit) {
+                sig.extra_digit = digit;
+                sig.has_extra_digit = true;
+                if (is_fractional) {
+                    sig.exponent -= 4;
+                }
+            }
+            else {
+                // Out of precision:
+                // only remember, if the dropped digit was nonzero
+                sig.sticky |= digit != 0;
+                if (!is_fractional) {
+                    sig.exponent += 4;
+                }
+            }
+        }
+        return it;
+    }
+
+    static iterator read_exponent(iterator it,
+                                  iterator end,
+                                  std::ptrdiff_t& exponent)
+    {
+        if (it == end || (*it != CharT{'p'} && *it != CharT{'P'})) {
+            return it;
+        }
+
+        auto exp_it = std::next(it);
+        bool is_negative = false;
+        if (exp_it != end && (*exp_it == CharT{'+'} || *exp_it == CharT{'-'})) {
+            is_negative = *exp_it == CharT{'-'};
+            ++exp_it;
+        }
+
+        const auto exp_digits_begin = exp_it;
+        std::ptrdiff_t exp_value = 0;
+        for (; exp_it != end; ++exp_it) {
+            const auto digit = char_to_int(*exp_it);
+            if (digit >= 10) {
+                break;
+            }
+            exp_value = (std::min)(exp_value * 10 + digit,
+                                   max_exponent_magnitude);
+        }
+        if (exp_it == exp_digits_begin) {
+            // No exponent digits: 'p' isn't a part of the value
+            return it;
+        }
+
+        exponent += is_negative ? -exp_value : exp_value;
+        return exp_it;
+    }
+
+    static scan_error make_float(significand sig, T& value)
+    {
+        if (sig.mantissa == 0) {
+            value = T{0};
+            return {};
+        }
+
+        // Normalize, so that the most significant bit of `top` is set:
+        // the value is (top + fraction of guard and sticky) * 2^e2
+        const int lz = count_leading_zeroes(sig.mantissa);
+        uint64_t top = sig.mantissa << lz;
+        std::ptrdiff_t e2 = sig.exponent - lz;
+        bool guard = false;
+        bool sticky = sig.sticky;
+        if (sig.has_extra_digit) {
+            SCN_EXPECT(lz < 4);
+            const int rest_bits = 4 - lz;
+            const unsigned rest = sig.extra_digit & ((1u << rest_bits) - 1u);
+            top |= static_cast<uint64_t>(sig.extra_digit >> rest_bits);
+            guard = ((rest >> (rest_bits - 1)) & 1u) != 0;
+            sticky |= (rest & ((1u << (rest_bits - 1)) - 1u)) != 0;
+            e2 += 4;
+        }
+
+        // Binary exponent of the leading bit
+        const std::ptrdiff_t exp = e2 + 63;
+        constexpr std::ptrdiff_t digits = std::numeric_limits<T>::digits;
+        constexpr std::ptrdiff_t min_exp =
+            std::numeric_limits<T>::min_exponent - 1;
+        constexpr std::ptrdiff_t max_exp =
+            std::numeric_limits<T>::max_exponent - 1;
+
+        if (exp > max_exp) {
+            SCN_UNLIKELY_ATTR
+            value = std::numeric_limits<T>::infinity();
+            return {scan_error::value_out_of_range, "hexfloat: overflow"};
+        }
+
+        // Number of mantissa bits to keep: less than `digits` for subnormals
+        const std::ptrdiff_t keep =
+            exp >= min_exp ? digits : digits - (min_exp - exp);
+        std::ptrdiff_t shift = 64 - keep;
+
+        // Round to nearest, ties to even
+        uint64_t q{};
+        bool half{};
+        bool rest{};
+        if (shift == 0) {
+            q = top;
+            half = guard;
+            rest = sticky;
+        }
+        else if (shift < 64) {
+            q = top >> shift;
+            half = ((top >> (shift - 1)) & 1u) != 0;
+            rest = (top & ((uint64_t{1} << (shift - 1)) - 1u)) != 0 || guard ||
+                   sticky;
+        }
+        else if (shift == 64) {
+            q = 0;
+            half = true;
+            rest = (top << 1) != 0 || guard || sticky;
+        }
+        else {
+            q = 0;
+            half = false;
+            rest = true;
+        }
+
+        if (half && (rest || (q & 1u) != 0)) {
+            if (q == std::numeric_limits<uint64_t>::max()) {
+                q = uint64_t{1} << 63;
+                ++shift;
+            }
+            else {
+                ++q;
+            }
+        }
+
+        if (q == 0) {
+            SCN_UNLIKELY_ATTR
+            value = T{0};
+            return {scan_error::value_out_of_range, "hexfloat: underflow"};
+        }
+
+        value = std::ldexp(static_cast<T>(q), static_cast<int>(e2 + shift));
+        if (SCN_UNLIKELY(std::isinf(value))) {
+            return {scan_error::value_out_of_range, "hexfloat: overflow"};
+        }
+        return {};
+    }
+
+    contiguous_range_factory<CharT>& m_input;
+};
+
+////////////////////////////////////////////////////////////////////
+// long double implementation
+// For all CharT, and FloatT=long double, if it's an IEEE type with
+// at least 64 bits of mantissa (x87 extended precision, or binary128)
+////////////////////////////////////////////////////////////////////
+
+inline constexpr bool has_native_long_double_impl =
+    std::numeric_limits<long double>::is_iec559 &&
+    std::numeric_limits<long double>::digits >= 64;
+
+template <typename CharT>
+class long_double_impl : impl_base {
+public:
+    explicit long_double_impl(impl_init_data<CharT> data)
+        : impl_base{data.base()}, m_input(data.input)
+    {
+    }
+
+    scan_expected<std::ptrdiff_t> operator()(long double& value) const
+    {
+        const auto input = m_input.view();
+
+        significand sig{};
+        auto it = read_significand(input, sig);
+        if (SCN_UNLIKELY(sig.digits_count == 0)) {
+            return unexpected_scan_error(scan_error::invalid_scanned_value,
+                                         "No significand digits in float");
+        }
+
+        const bool allowed_exp =
+            (m_options & float_reader_base::allow_scientific) != 0;
+        const bool required_exp =
+            allowed_exp && (m_options & float_reader_base::allow_fixed) == 0;
+        if (allowed_exp) {
+            const auto beg_exp_it = it;
+            it = read_exponent(it, input.end(), sig.exponent);
+            if (SCN_UNLIKELY(required_exp && beg_exp_it == it)) {
+                return unexpected_scan_error(
+                    scan_error::invalid_scanned_value,
+                    "No exponent given to scientific float");
+            }
+        }
+
+        const auto chars_read = ranges::distance(input.begin(), it);
+        if (sig.mantissa == 0) {
+            value = 0.0L;
+            return chars_read;
+        }
+
+        // Clinger's fast path:
+        // both the mantissa and the power of ten are exactly representable,
+        // so a single multiplication or division is correctly rounded
+        if (!sig.truncated && sig.exponent >= -max_exact_pow10 &&
+            sig.exponent <= max_exact_pow10) {
+            const auto m = static_cast<long double>(sig.mantissa);
+            if (sig.exponent < 0) {
+                value = m / pow10_table[static_cast<size_t>(-sig.exponent)];
+            }
+            else {
+                value = m * pow10_table[static_cast<size_t>(sig.exponent)];
+            }
+            return chars_read;
+        }
+
+#if !SCN_DISABLE_STRTOD
+        return strtod_buffer_impl<long double>{impl_base{m_kind, m_options}}(
+            value, input.substr(0, static_cast<size_t>(chars_read)));
+#else
+        return unexpected_scan_error(
+            scan_error::invalid_scanned_value,
+            "long double value not exactly representable, and fallback to "
+            "strtod disabled");
+#endif
+    }
+
+private:
+    using iterator = typename std::basic_string_view<CharT>::iterator;
+
+    // Parsed significand: the value is mantissa * 10^exponent.
+    // truncated is set, if nonzero digits were dropped from the mantissa.
+    struct significand {
+        uint64_t mantissa{0};
+        std::ptrdiff_t exponent{0};
+        std::ptrdiff_t digits_count{0};
+        std::ptrdiff_t mantissa_digits{0};
+        bool truncated{false};
+    };
+
+    // 10^19 > 2^63: at most 19 digits always fit into the mantissa
+    static constexpr std::ptrdiff_t max_mantissa_digits = 19;
+    static constexpr std::ptrdiff_t max_exponent_magnitude = 1 << 24;
+
+    static constexpr std::ptrdiff_t get_max_exact_pow10()
+    {
+        // 10^n = 2^n * 5^n is exactly representable,
+        // if 5^n fits in the (at least 64-bit) mantissa
+        std::ptrdiff_t n = 0;
+        uint64_t pow5 = 1;
+        while (pow5 <= (std::numeric_limits<uint64_t>::max)() / 5) {
+            pow5 *= 5;
+            ++n;
+        }
+        return n;
+    }
+    static constexpr std::ptrdiff_t max_exact_pow10 = get_max_exact_pow10();
+
+    static constexpr auto make_pow10_table()
+    {
+        std::array<long double, max_exact_pow10 + 1> table{};
+        long double val = 1.0L;
+        for (auto& elem : table) {
+            elem = val;
+            val *= 10.0L;
+        }
+        return table;
+    }
+    static constexpr auto pow10_table = make_pow10_table();
+
+    static iterator read_significand(std::basic_string_view<CharT> input,
+                                     significand& sig)
+    {
+        auto it = input.begin();
+        bool is_fractional = false;
+        for (; it != input.end(); ++it) {
+            if (*it == CharT{'.'} && !is_fractional) {
+                is_fractional = true;
+                continue;
+            }
+
+            const auto digit = char_to_int(*it);
+            if (digit >= 10) {
+                break;
+            }
+            ++sig.digits_count;
+
+            if (sig.mantissa == 0 && digit == 0) {
+                // Leading zero
+                if (is_fractional) {
+                    --sig.exponent;
+                }
+            }
+            else if (sig.mantissa_digits < max_mantissa_digits) {
+                sig.mantissa = sig.mantissa * 10 + digit;
+                ++sig.mantissa_digits;
+                if (is_fractional) {
+                    --sig.exponent;
+                }
+            }
+            else {
+                sig.truncated |= digit != 0;
+                if (!is_fractional) {
+                    ++sig.exponent;
+                }
+            }
+        }
+        return it;
+    }
+
+    static iterator read_exponent(iterator it,
+                                  iterator end,
+                                  std::ptrdiff_t& exponent)
+    {
+        if (it == end || (*it != CharT{'e'} && *it != CharT{'E'})) {
+            return it;
+        }
+
+        auto exp_it = std::next(it);
+        bool is_negative = false;
+        if (exp_it != end && (*exp_it == CharT{'+'} || *exp_it == CharT{'-'})) {
+            is_negative = *exp_it == CharT{'-'};
+            ++exp_it;
+        }
+
+        const auto exp_digits_begin = exp_it;
+        std::ptrdiff_t exp_value = 0;
+        for (; exp_it != end; ++exp_it) {
+            const auto digit = char_to_int(*exp_it);
+            if (digit >= 10) {
+                break;
+            }
+            exp_value = (std::min)(exp_value * 10 + digit,
+                                   max_exponent_magnitude);
+        }
+        if (exp_it == exp_digits_begin) {
+            // No exponent digits: 'e' isn't a part of the value
+            return it;
+        }
+
+        exponent += is_negative ? -exp_value : exp_value;
+        return exp_it;
+    }
+
+    contiguous_range_factory<CharT>& m_input;
+};
+
 ////////////////////////////////////////////////////////////////////
 // fast_float-based implementation
 // Only for FloatT=(float OR double)
@@ -497,12 +981,9 @@ struct fast_float_impl : fast_float_impl_base {
 
     scan_expected<std::ptrdiff_t> operator()(T& value) const
     {
-        if (m_kind == float_reader_base::float_kind::hex_without_prefix ||
-            m_kind == float_reader_base::float_kind::hex_with_prefix) {
-            // fast_float doesn't support hexfloats
-            return fast_float_fallback<CharT>({m_input, m_kind, m_options},
-                                              value);
-        }
+        // fast_float doesn't support hexfloats, see hexfloat_impl
+        SCN_EXPECT(m_kind != float_reader_base::float_kind::hex_without_prefix &&
+                   m_kind != float_reader_base::float_kind::hex_with_prefix);
 
         const auto flags = get_flags();
         const auto view = get_view();
@@ -605,11 +1086,23 @@ scan_expected<std::ptrdiff_t> dispatch_impl(
                                          "Invalid floating-point digit");
         }
     }
-    if (SCN_UNLIKELY(char_to_int(data.input.view().front()) >= 10)) {
+    else if (SCN_UNLIKELY(char_to_int(data.input.view().front()) >= 10)) {
         return unexpected_scan_error(scan_error::invalid_scanned_value,
                                      "Invalid floating-point digit");
     }
 
+    if (data.kind == float_reader_base::float_kind::hex_without_prefix ||
+        data.kind == float_reader_base::float_kind::hex_with_prefix) {
+        if constexpr (has_native_hexfloat_impl<T>) {
+            return hexfloat_impl<CharT, T>{data}(value);
+        }
+        else {
+            // e.g. IEEE binary128 or double-double long double:
+            // fall back to from_chars or strtod
+            return fast_float_fallback(data, value);
+        }
+    }
+
     if constexpr (std::is_same_v<T, long double>) {
         if constexpr (sizeof(double) == sizeof(long double)) {
             // If double == long double (true on Windows),
@@ -619,8 +1112,12 @@ scan_expected<std::ptrdiff_t> dispatch_impl(
             value = tmp;
             return ret;
         }
+        else if constexpr (has_native_long_double_impl) {
+            // long doubles aren't supported by fast_float
+            return long_double_impl<CharT>{data}(value);
+        }
         else {
-            // long doubles aren't supported by fast_float ->
+            // e.g. double-double:
             // fall back to from_chars or strtod
             return fast_float_fallback(data, value);
         }
@@ -634,16 +1131,19 @@ scan_expected<std::ptrdiff_t> dispatch_impl(
 
 template <typename CharT>
 template <typename T>
-scan_expected<std::ptrdiff_t> float_reader<CharT>::parse_value_impl(T& value)
+scan_expected<std::ptrdiff_t> float_reader<CharT>::parse_value_impl(
+    contiguous_range_factory<CharT>& input,
+    T& value)
 {
-    auto n = dispatch_impl<CharT>({this->m_buffer, m_kind, m_options},
+    auto n = dispatch_impl<CharT>({input, m_kind, m_options},
                                   m_nan_payload_buffer, value);
     value = this->setsign(value);
     return n;
 }
 
-#define SCN_DEFINE_FLOAT_READER_TEMPLATE(CharT, FloatT)          \
-    template auto float_reader<CharT>::parse_value_impl(FloatT&) \
+#define SCN_DEFINE_FLOAT_READER_TEMPLATE(CharT, FloatT)   \
+    template auto float_reader<CharT>::parse_value_impl(  \
+        contiguous_range_factory<CharT>&, FloatT&)        \
         -> scan_expected<std::ptrdiff_t>;
 
 #if !SCN_DISABLE_TYPE_FLOAT
@@ -19,6 +19,7 @@
 
 #include <scn/impl/reader/numeric_reader.h>
 
+#include <array>
 #include <cmath>
 #include <limits>
 
@@ -100,7 +101,12 @@ public:
         const std::ptrdiff_t sign_len =
             m_sign != sign_type::default_sign ? 1 : 0;
 
-        SCN_TRY(n, parse_value_impl(value));
+        if (SCN_UNLIKELY(needs_normalization())) {
+            SCN_TRY(n, parse_normalized_value(value));
+            return n + sign_len + ranges::ssize(m_thsep_indices);
+        }
+
+        SCN_TRY(n, parse_value_impl(this->m_buffer, value));
         return n + sign_len + ranges::ssize(m_thsep_indices);
     }
 
@@ -477,45 +483,62 @@ private:
         }
     }
 
+    bool needs_normalization() const
+    {
+        return m_locale_options.thousands_sep != 0 ||
+               m_locale_options.decimal_point != CharT{'.'};
+    }
+
     void handle_separators()
     {
-        if (m_locale_options.thousands_sep == 0 &&
-            m_locale_options.decimal_point == CharT{'.'}) {
+        if (m_locale_options.thousands_sep == 0) {
             return;
         }
 
-        auto& str = this->m_buffer.make_into_allocated_string();
-        if (m_locale_options.decimal_point != CharT{'.'}) {
-            for (auto& ch : str) {
-                if (ch == m_locale_options.decimal_point) {
-                    ch = CharT{'.'};
-                }
+        const auto input = this->m_buffer.view();
+        for (std::size_t i = 0; i < input.size(); ++i) {
+            if (input[i] == m_locale_options.thousands_sep) {
+                m_thsep_indices.push_back(static_cast<char>(i));
             }
         }
+    }
 
-        if (m_locale_options.thousands_sep == 0) {
-            return;
+    template <typename T>
+    scan_expected<std::ptrdiff_t> parse_normalized_value(T& value)
+    {
+        // Normalize into the form expected by the parsing backends:
+        // '.' as the decimal point, and no thousands separators.
+        // Short values are written into a buffer on the stack,
+        // to avoid allocating.
+        const auto input = this->m_buffer.view();
+        std::array<CharT, 64> stack_buffer;
+        std::basic_string<CharT> heap_buffer{};
+        CharT* out_begin = stack_buffer.data();
+        if (input.size() > stack_buffer.size()) {
+            SCN_UNLIKELY_ATTR
+            heap_buffer.resize(input.size());
+            out_begin = heap_buffer.data();
+        }
+
+        auto out = out_begin;
+        for (const auto ch : input) {
+            if (m_locale_options.thousands_sep != 0 &&
+                ch == m_locale_options.thousands_sep) {
+                continue;
+            }
+            *out++ = ch == m_locale_options.decimal_point ? CharT{'.'} : ch;
         }
 
-        auto first = ranges::find(str, m_locale_options.thousands_sep);
-        if (first == str.end()) {
-            return;
+        contiguous_range_factory<CharT> normalized{};
+        if (heap_buffer.empty()) {
+            normalized.assign(std::basic_string_view<CharT>{
+                out_begin, static_cast<std::size_t>(out - out_begin)});
         }
-
-        m_thsep_indices.push_back(
-            static_cast<char>(ranges::distance(str.begin(), first)));
-
-        for (auto it = first; ++it != str.end();) {
-            if (*it != m_locale_options.thousands_sep) {
-                *first++ = std::move(*it);
-            }
-            else {
-                m_thsep_indices.push_back(
-                    static_cast<char>(ranges::distance(str.begin(), it)));
-            }
+        else {
+            heap_buffer.erase(static_cast<std::size_t>(out - out_begin));
+            normalized.assign(SCN_MOVE(heap_buffer));
         }
-
-        str.erase(first, str.end());
+        return parse_value_impl(normalized, value);
     }
 
     template <typename T>
@@ -529,7 +552,9 @@ private:
     }
 
     template <typename T>
-    scan_expected<std::ptrdiff_t> parse_value_impl(T& value);
+    scan_expected<std::ptrdiff_t> parse_value_impl(
+        contiguous_range_factory<CharT>& input,
+        T& value);
 
     localized_number_formatting_options<CharT> m_locale_options{};
     std::string m_thsep_indices{};
@@ -539,8 +564,9 @@ private:
     float_kind m_kind{float_kind::tbd};
 };
 
-#define SCN_DECLARE_FLOAT_READER_TEMPLATE(CharT, FloatT)                \
-    extern template auto float_reader<CharT>::parse_value_impl(FloatT&) \
+#define SCN_DECLARE_FLOAT_READER_TEMPLATE(CharT, FloatT)         \
+    extern template auto float_reader<CharT>::parse_value_impl(  \
+        contiguous_range_factory<CharT>&, FloatT&)               \
         -> scan_expected<std::ptrdiff_t>;
 
 #if !SCN_DISABLE_TYPE_FLOAT
@@ -39,6 +39,19 @@ uint64_t get_eight_digits_word(const char* input)
     return val;
 }
 
+uint64_t get_eight_digits_word(const wchar_t* input)
+{
+    // Narrow every code unit into a byte, in the same order as above.
+    // Code units that don't fit are mapped to 0xff,
+    // so that they're not mistaken for digits.
+    uint64_t val{};
+    for (std::size_t i = 0; i < 8; ++i) {
+        const auto cu = static_cast<uint32_t>(input[i]);
+        val |= static_cast<uint64_t>(cu <= 0xff ? cu : 0xff) << (i * 8);
+    }
+    return val;
+}
+
 constexpr uint32_t parse_eight_decimal_digits_unrolled_fast(uint64_t word)
 {
     constexpr uint64_t mask = 0x000000FF000000FF;
@@ -56,22 +69,26 @@ constexpr bool is_word_made_of_eight_decimal_digits_fast(uint64_t word)
               0x8080808080808080));
 }
 
-void loop_parse_if_eight_decimal_digits(const char*& p,
-                                        const char* const end,
+template <typename CharT>
+void loop_parse_if_eight_decimal_digits(const CharT*& p,
+                                        const CharT* const end,
                                         uint64_t& val)
 {
-    while (
-        std::distance(p, end) >= 8 &&
-        is_word_made_of_eight_decimal_digits_fast(get_eight_digits_word(p))) {
-        val = val * 100'000'000 + parse_eight_decimal_digits_unrolled_fast(
-                                      get_eight_digits_word(p));
+    while (std::distance(p, end) >= 8) {
+        const auto word = get_eight_digits_word(p);
+        if (!is_word_made_of_eight_decimal_digits_fast(word)) {
+            break;
+        }
+        val = val * 100'000'000 +
+              parse_eight_decimal_digits_unrolled_fast(word);
         p += 8;
     }
 }
 
-const char* parse_decimal_integer_fast_impl(const char* begin,
-                                            const char* const end,
-                                            uint64_t& val)
+template <typename CharT>
+const CharT* parse_decimal_integer_fast_impl(const CharT* begin,
+                                             const CharT* const end,
+                                             uint64_t& val)
 {
     loop_parse_if_eight_decimal_digits(begin, end, val);
 
@@ -156,10 +173,10 @@ constexpr T store_result(uint64_t u64val, bool is_negative)
     return static_cast<T>(u64val);
 }
 
-template <typename T>
-auto parse_decimal_integer_fast(std::string_view input,
+template <typename CharT, typename T>
+auto parse_decimal_integer_fast(std::basic_string_view<CharT> input,
                                 T& val,
-                                bool is_negative) -> scan_expected<const char*>
+                                bool is_negative) -> scan_expected<const CharT*>
 {
     uint64_t u64val{};
     auto ptr = parse_decimal_integer_fast_impl(
@@ -242,14 +259,12 @@ auto parse_integer_value(std::basic_string_view<CharT> source,
         }
     }
 
-    if constexpr (std::is_same_v<CharT, char>) {
-        if (base == 10) {
-            SCN_TRY(ptr, parse_decimal_integer_fast(
-                             detail::make_string_view_from_pointers(start, end),
-                             value, sign == sign_type::minus_sign));
-            return ranges::next(source.begin(),
-                                ranges::distance(source.data(), ptr));
-        }
+    if (base == 10) {
+        SCN_TRY(ptr, parse_decimal_integer_fast(
+                         detail::make_string_view_from_pointers(start, end),
+                         value, sign == sign_type::minus_sign));
+        return ranges::next(source.begin(),
+                            ranges::distance(source.data(), ptr));
     }
 
     SCN_TRY(ptr, parse_regular_integer(
@@ -258,6 +273,26 @@ auto parse_integer_value(std::basic_string_view<CharT> source,
     return ranges::next(source.begin(), ranges::distance(source.data(), ptr));
 }
 
+template <typename T>
+auto store_integer_value(uint64_t u64val,
+                         std::size_t digits_count,
+                         sign_type sign,
+                         int base,
+                         T& value) -> scan_error
+{
+    SCN_EXPECT(std::is_signed_v<T> || sign == sign_type::plus_sign);
+    SCN_EXPECT(sign != sign_type::default_sign);
+    SCN_EXPECT(base > 0);
+
+    if (SCN_UNLIKELY(check_integer_overflow<T>(
+            u64val, digits_count, base, sign == sign_type::minus_sign))) {
+        return {scan_error::value_out_of_range, "Integer overflow"};
+    }
+
+    value = store_result<T>(u64val, sign == sign_type::minus_sign);
+    return {};
+}
+
 template <typename T>
 void parse_integer_value_exhaustive_valid(std::string_view source, T& value)
 {
@@ -312,57 +347,77 @@ void parse_integer_value_exhaustive_valid(std::string_view source, T& value)
 #if !SCN_DISABLE_TYPE_SCHAR
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, signed char)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, signed char)
+template auto store_integer_value(uint64_t, std::size_t, sign_type, int,
+                                  signed char&) -> scan_error;
 template void parse_integer_value_exhaustive_valid(std::string_view,
                                                    signed char&);
 #endif
 #if !SCN_DISABLE_TYPE_SHORT
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, short)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, short)
+template auto store_integer_value(uint64_t, std::size_t, sign_type, int,
+                                  short&) -> scan_error;
 template void parse_integer_value_exhaustive_valid(std::string_view, short&);
 #endif
 #if !SCN_DISABLE_TYPE_INT
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, int)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, int)
+template auto store_integer_value(uint64_t, std::size_t, sign_type, int,
+                                  int&) -> scan_error;
 template void parse_integer_value_exhaustive_valid(std::string_view, int&);
 #endif
 #if !SCN_DISABLE_TYPE_LONG
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, long)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, long)
+template auto store_integer_value(uint64_t, std::size_t, sign_type, int,
+                                  long&) -> scan_error;
 template void parse_integer_value_exhaustive_valid(std::string_view, long&);
 #endif
 #if !SCN_DISABLE_TYPE_LONG_LONG
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, long long)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, long long)
+template auto store_integer_value(uint64_t, std::size_t, sign_type, int,
+                                  long long&) -> scan_error;
 template void parse_integer_value_exhaustive_valid(std::string_view,
                                                    long long&);
 #endif
 #if !SCN_DISABLE_TYPE_UCHAR
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, unsigned char)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, unsigned char)
+template auto store_integer_value(uint64_t, std::size_t, sign_type, int,
+                                  unsigned char&) -> scan_error;
 template void parse_integer_value_exhaustive_valid(std::string_view,
                                                    unsigned char&);
 #endif
 #if !SCN_DISABLE_TYPE_USHORT
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, unsigned short)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, unsigned short)
+template auto store_integer_value(uint64_t, std::size_t, sign_type, int,
+                                  unsigned short&) -> scan_error;
 template void parse_integer_value_exhaustive_valid(std::string_view,
                                                    unsigned short&);
 #endif
 #if !SCN_DISABLE_TYPE_UINT
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, unsigned int)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, unsigned int)
+template auto store_integer_value(uint64_t, std::size_t, sign_type, int,
+                                  unsigned int&) -> scan_error;
 template void parse_integer_value_exhaustive_valid(std::string_view,
                                                    unsigned int&);
 #endif
 #if !SCN_DISABLE_TYPE_ULONG
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, unsigned long)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, unsigned long)
+template auto store_integer_value(uint64_t, std::size_t, sign_type, int,
+                                  unsigned long&) -> scan_error;
 template void parse_integer_value_exhaustive_valid(std::string_view,
                                                    unsigned long&);
 #endif
 #if !SCN_DISABLE_TYPE_ULONG_LONG
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, unsigned long long)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, unsigned long long)
+template auto store_integer_value(uint64_t, std::size_t, sign_type, int,
+                                  unsigned long long&) -> scan_error;
 template void parse_integer_value_exhaustive_valid(std::string_view,
                                                    unsigned long long&);
 #endif
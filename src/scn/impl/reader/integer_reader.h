@@ -173,38 +173,65 @@ auto parse_integer_digits_without_thsep(Range range, int base)
     }
 }
 
+template <typename Iterator>
+struct parse_integer_digits_with_thsep_result {
+    Iterator iterator;
+    uint64_t value;
+    std::size_t digits_count;
+};
+
+/**
+ * Reads digits and thousands separators, validating the grouping and
+ * accumulating the (possibly wrapped-around) value as it goes.
+ * `digits_count` doesn't include leading zeroes,
+ * and is used to detect overflow in `store_integer_value`.
+ */
 template <typename Range, typename CharT>
 auto parse_integer_digits_with_thsep(
     Range range,
     int base,
     const localized_number_formatting_options<CharT>& locale_options)
-    -> scan_expected<std::tuple<ranges::iterator_t<Range>,
-                                std::basic_string<CharT>,
-                                std::string>>
+    -> scan_expected<
+        parse_integer_digits_with_thsep_result<ranges::iterator_t<Range>>>
 {
-    std::basic_string<CharT> output;
-    std::string thsep_indices;
-    auto it = ranges::begin(range);
+    thsep_grouping_checker grouping_checker{locale_options.grouping};
+    uint64_t value{0};
+    std::size_t digits_count{0};
     bool digit_matched = false;
+
+    auto it = ranges::begin(range);
     for (; it != ranges::end(range); ++it) {
         if (*it == locale_options.thousands_sep) {
-            thsep_indices.push_back(static_cast<char>(
-                ranges_polyfill::pos_distance(ranges::begin(range), it)));
+            grouping_checker.on_separator();
+            continue;
         }
-        else if (char_to_int(*it) >= base) {
+
+        const auto digit = char_to_int(*it);
+        if (digit >= base) {
             break;
         }
-        else {
-            output.push_back(*it);
-            digit_matched = true;
+
+        grouping_checker.on_digit();
+        digit_matched = true;
+        if (value != 0 || digit != 0) {
+            value = static_cast<uint64_t>(base) * value +
+                    static_cast<uint64_t>(digit);
+            ++digits_count;
         }
     }
+
     if (SCN_UNLIKELY(!digit_matched)) {
         return unexpected_scan_error(
             scan_error::invalid_scanned_value,
             "Failed to parse integer: No digits found");
     }
-    return std::tuple{it, output, thsep_indices};
+    if (grouping_checker.has_separators() && !grouping_checker.finish()) {
+        SCN_UNLIKELY_ATTR
+        return unexpected_scan_error(scan_error::invalid_scanned_value,
+                                     "Invalid thousands separator grouping");
+    }
+    return parse_integer_digits_with_thsep_result<ranges::iterator_t<Range>>{
+        it, value, digits_count};
 }
 
 template <typename CharT, typename T>
@@ -214,6 +241,13 @@ auto parse_integer_value(std::basic_string_view<CharT> source,
                          int base)
     -> scan_expected<typename std::basic_string_view<CharT>::iterator>;
 
+template <typename T>
+auto store_integer_value(uint64_t u64val,
+                         std::size_t digits_count,
+                         sign_type sign,
+                         int base,
+                         T& value) -> scan_error;
+
 template <typename T>
 void parse_integer_value_exhaustive_valid(std::string_view source, T& value);
 
@@ -222,6 +256,9 @@ void parse_integer_value_exhaustive_valid(std::string_view source, T& value);
         std::basic_string_view<CharT> source, IntT& value, sign_type sign,  \
         int base)                                                           \
         -> scan_expected<typename std::basic_string_view<CharT>::iterator>; \
+    extern template auto store_integer_value(uint64_t, std::size_t,         \
+                                             sign_type, int, IntT&)         \
+        -> scan_error;                                                      \
     extern template void parse_integer_value_exhaustive_valid(              \
         std::string_view, IntT&);
 
@@ -383,33 +420,17 @@ public:
 #endif
 
         SCN_TRY(
-            parse_digits_result,
+            digits_result,
             parse_integer_digits_with_thsep(
                 ranges::subrange{prefix_result.iterator, ranges::end(range)},
                 prefix_result.parsed_base, locale_options));
-        const auto& [after_digits_it, nothsep_source, thsep_indices] =
-            parse_digits_result;
-
-        if (!thsep_indices.empty()) {
-            if (auto e = check_thsep_grouping(
-                    ranges::subrange{prefix_result.iterator, after_digits_it},
-                    thsep_indices, locale_options.grouping);
-                SCN_UNLIKELY(!e)) {
-                return unexpected(e);
-            }
+        if (auto e = store_integer_value(
+                digits_result.value, digits_result.digits_count,
+                prefix_result.sign, prefix_result.parsed_base, value);
+            SCN_UNLIKELY(!e)) {
+            return unexpected(e);
         }
-
-        auto nothsep_source_view =
-            std::basic_string_view<CharT>{nothsep_source};
-        SCN_TRY(
-            nothsep_source_it,
-            parse_integer_value(nothsep_source_view, value, prefix_result.sign,
-                                prefix_result.parsed_base));
-
-        return ranges_polyfill::batch_next(
-            prefix_result.iterator,
-            ranges::distance(nothsep_source_view.begin(), nothsep_source_it) +
-                ranges::ssize(thsep_indices));
+        return digits_result.iterator;
     }
 };
 }  // namespace impl
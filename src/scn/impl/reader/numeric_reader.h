@@ -148,6 +148,97 @@ scan_error check_thsep_grouping(Range&& range,
     return {};
 }
 
+/**
+ * Validates thousands separator grouping incrementally, while the digits are
+ * being read, without storing the separator positions.
+ *
+ * Groups are matched against `grouping` from the right, so only the last
+ * `max_tracked_groups` group lengths are kept around: any group older than
+ * that can only be matched against `grouping.back()`.
+ * Entries in `grouping` past `max_tracked_groups` are never consulted.
+ */
+class thsep_grouping_checker {
+public:
+    static constexpr std::size_t max_tracked_groups = 32;
+
+    explicit constexpr thsep_grouping_checker(std::string_view grouping)
+        : m_grouping(grouping)
+    {
+    }
+
+    constexpr void on_digit()
+    {
+        ++m_current_group_length;
+    }
+
+    constexpr void on_separator()
+    {
+        push_group(m_current_group_length);
+        m_current_group_length = 0;
+    }
+
+    SCN_NODISCARD constexpr bool has_separators() const
+    {
+        return m_group_count != 0;
+    }
+
+    /// Call after the last digit has been read
+    SCN_NODISCARD constexpr bool finish()
+    {
+        SCN_EXPECT(has_separators());
+        push_group(m_current_group_length);
+
+        if (SCN_UNLIKELY(!m_valid || m_grouping.empty())) {
+            return false;
+        }
+
+        const auto tracked = std::min(m_group_count, max_tracked_groups);
+        for (std::size_t k = 0; k < tracked; ++k) {
+            const auto idx = m_group_count - 1 - k;
+            const auto len = m_groups[idx % max_tracked_groups];
+            if (idx == 0) {
+                return len <= grouping_at(m_grouping.size() - 1);
+            }
+            if (len != grouping_at(std::min(k, m_grouping.size() - 1))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    constexpr std::size_t grouping_at(std::size_t i) const
+    {
+        return static_cast<std::size_t>(
+            static_cast<unsigned char>(m_grouping[i]));
+    }
+
+    constexpr void push_group(std::size_t len)
+    {
+        const auto slot = m_group_count % max_tracked_groups;
+        if (m_group_count >= max_tracked_groups && !m_grouping.empty()) {
+            // Evicted group is too far from the right to be matched against
+            // anything other than the last grouping entry
+            const auto evicted = m_groups[slot];
+            const auto last = grouping_at(m_grouping.size() - 1);
+            if (m_group_count == max_tracked_groups) {
+                m_valid = m_valid && evicted <= last;
+            }
+            else {
+                m_valid = m_valid && evicted == last;
+            }
+        }
+        m_groups[slot] = len;
+        ++m_group_count;
+    }
+
+    std::string_view m_grouping;
+    std::array<std::size_t, max_tracked_groups> m_groups{};
+    std::size_t m_group_count{0};
+    std::size_t m_current_group_length{0};
+    bool m_valid{true};
+};
+
 template <typename CharT>
 class numeric_reader {
 public:
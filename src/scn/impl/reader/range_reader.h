@@ -0,0 +1,126 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#pragma once
+
+#include <scn/impl/reader/reader.h>
+
+#include <algorithm>
+
+namespace scn {
+SCN_BEGIN_NAMESPACE
+
+namespace impl {
+/**
+ * Estimates the number of elements in a range like "[1, 2, 3]",
+ * from the separators before the first closing bracket in `input`.
+ * Returns 0 if no estimate can be made.
+ */
+template <typename CharT>
+std::size_t estimate_range_element_count(
+    std::basic_string_view<CharT> input,
+    std::basic_string_view<CharT> separator,
+    std::basic_string_view<CharT> closing_bracket)
+{
+    if (separator.empty() || closing_bracket.empty() || input.empty()) {
+        return 0;
+    }
+
+    const auto searched =
+        input.substr(0, input.find(closing_bracket.front()));
+    const auto separators =
+        std::count(searched.begin(), searched.end(), separator.front());
+    return static_cast<std::size_t>(separators) + 1;
+}
+
+template <typename T, typename Range>
+scan_expected<ranges::iterator_t<Range>> read_range_elements_impl(
+    Range range,
+    std::basic_string_view<detail::char_t<Range>> separator,
+    std::basic_string_view<detail::char_t<Range>> closing_bracket,
+    bool is_first,
+    T* elements,
+    std::size_t max_count,
+    std::size_t& count)
+{
+    auto rd = make_reader<T, detail::char_t<Range>>();
+    auto it = ranges::begin(range);
+    const auto end = ranges::end(range);
+    for (count = 0; count < max_count; ++count) {
+        SCN_TRY(elem_begin, skip_classic_whitespace(ranges::subrange{it, end})
+                                .transform_error(make_eof_scan_error));
+        if (read_matching_string(ranges::subrange{elem_begin, end},
+                                 closing_bracket)) {
+            break;
+        }
+
+        if (!is_first) {
+            auto sep_it = read_matching_string(
+                ranges::subrange{elem_begin, end}, separator);
+            if (SCN_UNLIKELY(!sep_it)) {
+                return unexpected_scan_error(scan_error::invalid_scanned_value,
+                                             "Invalid range character");
+            }
+            SCN_TRY_ASSIGN(elem_begin,
+                           skip_ws_before_if_required(
+                               rd.skip_ws_before_read(),
+                               ranges::subrange{*sep_it, end}, {})
+                               .transform_error(make_eof_scan_error));
+        }
+        is_first = false;
+
+        SCN_TRY_ASSIGN(it, rd.read_default(ranges::subrange{elem_begin, end},
+                                           elements[count], {}));
+    }
+    return it;
+}
+
+/**
+ * Reads up to `max_count` elements of a range into `elements`,
+ * stopping before a closing bracket.
+ * Every element, except the first one if `is_first` is set,
+ * must be preceded by `separator`.
+ *
+ * The elements are read with the default reader for `T`,
+ * as if scanned with `{}`, and without going through `scanner<T>`.
+ */
+template <typename T, typename Range>
+scan_expected<ranges::iterator_t<Range>> read_range_elements(
+    Range range,
+    std::basic_string_view<detail::char_t<Range>> separator,
+    std::basic_string_view<detail::char_t<Range>> closing_bracket,
+    bool is_first,
+    T* elements,
+    std::size_t max_count,
+    std::size_t& count)
+{
+    if (!is_segment_contiguous(range)) {
+        return read_range_elements_impl(range, separator, closing_bracket,
+                                        is_first, elements, max_count, count);
+    }
+
+    auto crange = get_as_contiguous(range);
+    SCN_TRY(it, read_range_elements_impl(crange, separator, closing_bracket,
+                                         is_first, elements, max_count,
+                                         count));
+    return ranges_polyfill::batch_next(ranges::begin(range),
+                                       ranges::distance(crange.begin(), it));
+}
+}  // namespace impl
+
+SCN_END_NAMESPACE
+}  // namespace scn
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <scn/detail/args.h>
+#include <scn/detail/context.h>
 #include <scn/detail/format_string.h>
 #include <scn/detail/xchar.h>
 
@@ -28,7 +29,6 @@
 #include <scn/impl/reader/pointer_reader.h>
 #include <scn/impl/reader/regex_reader.h>
 #include <scn/impl/reader/string_reader.h>
-#include <scn/impl/util/contiguous_context.h>
 
 namespace scn {
 SCN_BEGIN_NAMESPACE
@@ -95,6 +95,22 @@ constexpr auto make_reader()
     }
 }
 
+template <typename T, typename CharT>
+auto make_reader(encoding_validation_cache<CharT>* validation_cache,
+                 std::basic_string<CharT>* transcode_scratch = nullptr)
+{
+    auto rd = make_reader<T, CharT>();
+    if constexpr (std::is_same_v<decltype(rd), reader_impl_for_string<CharT>>) {
+        rd.set_validation_cache(validation_cache);
+        rd.set_transcode_scratch(transcode_scratch);
+    }
+    else {
+        SCN_UNUSED(validation_cache);
+        SCN_UNUSED(transcode_scratch);
+    }
+    return rd;
+}
+
 template <typename Context>
 struct default_arg_reader {
     using context_type = Context;
@@ -123,11 +139,13 @@ struct default_arg_reader {
                       std::is_same_v<
                           context_type,
                           basic_contiguous_scan_context<char_type>>) {
-            auto rd = make_reader<T, char_type>();
+            auto rd =
+                make_reader<T, char_type>(validation_cache, transcode_scratch);
             return impl(rd, range, value);
         }
         else if constexpr (!detail::is_type_disabled<T>) {
-            auto rd = make_reader<T, char_type>();
+            auto rd =
+                make_reader<T, char_type>(validation_cache, transcode_scratch);
             if (!is_segment_contiguous(range)) {
                 return impl(rd, range, value);
             }
@@ -142,17 +160,12 @@ struct default_arg_reader {
         }
     }
 
-    basic_scan_context<char_type> make_custom_ctx()
+    context_type make_custom_ctx()
     {
         if constexpr (std::is_same_v<
                           context_type,
                           basic_contiguous_scan_context<char_type>>) {
-            auto it =
-                typename detail::basic_scan_buffer<char_type>::forward_iterator{
-                    std::basic_string_view<char_type>(range.data(),
-                                                      range.size()),
-                    0};
-            return {it, args, loc};
+            return {range, args, loc};
         }
         else {
             return {range.begin(), args, loc};
@@ -168,15 +181,7 @@ struct default_arg_reader {
             if (auto e = h.scan(parse_ctx, ctx); !e) {
                 return unexpected(e);
             }
-
-            if constexpr (std::is_same_v<
-                              context_type,
-                              basic_contiguous_scan_context<char_type>>) {
-                return range.begin() + ctx.begin().position();
-            }
-            else {
-                return ctx.begin();
-            }
+            return ctx.begin();
         }
         else {
             SCN_EXPECT(false);
@@ -187,6 +192,8 @@ struct default_arg_reader {
     range_type range;
     args_type args;
     detail::locale_ref loc;
+    encoding_validation_cache<char_type>* validation_cache{nullptr};
+    std::basic_string<char_type>* transcode_scratch{nullptr};
 };
 
 template <typename Context>
@@ -209,9 +216,22 @@ struct arg_reader {
         auto subr = ranges::subrange{it, ranges::end(rng)};
 
         if (specs.width != 0) {
-            SCN_TRY(w_it, rd.read_specs(take_width(subr, specs.width), specs,
-                                        value, loc));
-            return w_it.base();
+            if constexpr (ranges::contiguous_range<Range> &&
+                          ranges::sized_range<Range>) {
+                // Find the end of the field in one pass,
+                // so that the value can be read with the contiguous fast paths
+                auto field = ranges::subrange{
+                    ranges::begin(subr),
+                    read_exactly_n_width_units(
+                        subr, static_cast<ranges::range_difference_t<Range>>(
+                                  specs.width))};
+                return rd.read_specs(field, specs, value, loc);
+            }
+            else {
+                SCN_TRY(w_it, rd.read_specs(take_width(subr, specs.width),
+                                            specs, value, loc));
+                return w_it.base();
+            }
         }
 
         return rd.read_specs(subr, specs, value, loc);
@@ -224,7 +244,8 @@ struct arg_reader {
                       std::is_same_v<
                           context_type,
                           basic_contiguous_scan_context<char_type>>) {
-            auto rd = make_reader<T, char_type>();
+            auto rd =
+                make_reader<T, char_type>(validation_cache, transcode_scratch);
             if (auto e = rd.check_specs(specs); SCN_UNLIKELY(!e)) {
                 return unexpected(e);
             }
@@ -232,12 +253,13 @@ struct arg_reader {
             return impl(rd, range, value);
         }
         else if constexpr (!detail::is_type_disabled<T>) {
-            auto rd = make_reader<T, char_type>();
+            auto rd =
+                make_reader<T, char_type>(validation_cache, transcode_scratch);
             if (auto e = rd.check_specs(specs); SCN_UNLIKELY(!e)) {
                 return unexpected(e);
             }
 
-            if (!is_segment_contiguous(range) || specs.width != 0) {
+            if (!is_segment_contiguous(range)) {
                 return impl(rd, range, value);
             }
 
@@ -261,6 +283,8 @@ struct arg_reader {
     range_type range;
     const detail::format_specs& specs;
     detail::locale_ref loc;
+    encoding_validation_cache<char_type>* validation_cache{nullptr};
+    std::basic_string<char_type>* transcode_scratch{nullptr};
 };
 
 template <typename Context>
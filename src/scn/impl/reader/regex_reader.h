@@ -21,6 +21,14 @@
 
 #include <scn/impl/reader/common.h>
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
 #include <regex>
 #if SCN_REGEX_BOOST_USE_ICU
@@ -123,28 +131,249 @@ inline auto make_regex_flags(detail::regex_flags flags)
 }
 #endif  // SCN_REGEX_BACKEND == ...
 
-template <typename CharT, typename Input>
-auto read_regex_string_impl(std::basic_string_view<CharT> pattern,
-                            detail::regex_flags flags,
-                            Input input)
-    -> scan_expected<ranges::iterator_t<Input>>
+/// Calls `f` with the name of every `(?<name>...)` group in `pattern`,
+/// as a view into `pattern`
+template <typename CharT, typename F>
+void for_each_regex_capture_name(std::basic_string_view<CharT> pattern, F f)
 {
-    static_assert(ranges::contiguous_range<Input> &&
-                  ranges::borrowed_range<Input> &&
-                  std::is_same_v<ranges::range_value_t<Input>, CharT>);
+    for (size_t i = 0; i < pattern.size();) {
+        if constexpr (std::is_same_v<CharT, char>) {
+            i = pattern.find("(?<", i);
+        }
+        else {
+            i = pattern.find(L"(?<", i);
+        }
 
+        if (i == std::basic_string_view<CharT>::npos) {
+            break;
+        }
+        if (i > 0 && pattern[i - 1] == CharT{'\\'}) {
+            if (i == 1 || pattern[i - 2] != CharT{'\\'}) {
+                i += 3;
+                continue;
+            }
+        }
+
+        i += 3;
+        if (i < pattern.size() &&
+            (pattern[i] == CharT{'='} || pattern[i] == CharT{'!'})) {
+            // Lookbehind, not a named group
+            continue;
+        }
+        auto end_i = pattern.find(CharT{'>'}, i);
+        if (end_i == std::basic_string_view<CharT>::npos) {
+            break;
+        }
+        f(pattern.substr(i, end_i - i));
+    }
+}
+
+/**
+ * A regular expression, compiled with the regex backend.
+ * Created with `compile_regex`, and shared through `regex_cache`,
+ * so it's only ever used through a `const` reference.
+ */
+template <typename CharT>
+struct compiled_regex {
+#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
+    std::basic_regex<CharT> re;
+#elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_BOOST
+#if SCN_REGEX_BOOST_USE_ICU
+    boost::u32regex re;
+#else
+    boost::basic_regex<CharT> re;
+#endif
+#elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_RE2
+    // re2::RE2 is neither copyable nor movable
+    compiled_regex(std::string_view pattern, const RE2::Options& opts)
+        : re(pattern, opts)
+    {
+    }
+
+    re2::RE2 re;
+#endif
+};
+
+template <typename CharT>
+using compiled_regex_ptr = std::shared_ptr<const compiled_regex<CharT>>;
+
+template <typename CharT>
+auto compile_regex(std::basic_string_view<CharT> pattern,
+                   detail::regex_flags flags)
+    -> scan_expected<compiled_regex_ptr<CharT>>
+{
 #if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
-    std::basic_regex<CharT> re{};
     try {
         SCN_TRY(re_flags, make_regex_flags(flags));
-        re = std::basic_regex<CharT>{pattern.data(), pattern.size(),
-                                     re_flags | std::regex_constants::nosubs};
+        return std::make_shared<const compiled_regex<CharT>>(
+            compiled_regex<CharT>{std::basic_regex<CharT>{
+                pattern.data(), pattern.size(), re_flags}});
     }
     catch (const std::regex_error& err) {
         return unexpected_scan_error(scan_error::invalid_format_string,
                                      "Invalid regex");
     }
+#elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_BOOST
+    auto re =
+#if SCN_REGEX_BOOST_USE_ICU
+        boost::make_u32regex(
+            pattern.data(), pattern.data() + pattern.size(),
+            make_regex_flags(flags) | boost::regex_constants::no_except);
+#else
+        boost::basic_regex<CharT>{
+            pattern.data(), pattern.size(),
+            make_regex_flags(flags) | boost::regex_constants::no_except};
+#endif
+    if (re.status() != 0) {
+        return unexpected_scan_error(scan_error::invalid_format_string,
+                                     "Invalid regex");
+    }
+    return std::make_shared<const compiled_regex<CharT>>(
+        compiled_regex<CharT>{SCN_MOVE(re)});
+#elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_RE2
+    static_assert(std::is_same_v<CharT, char>);
+    const auto [opts, flagstr] = make_regex_flags(flags);
+    compiled_regex_ptr<char> re{};
+    if (flagstr.empty()) {
+        re = std::make_shared<const compiled_regex<char>>(pattern, opts);
+    }
+    else {
+        std::string flagged_pattern{};
+        flagged_pattern.reserve(flagstr.size() + pattern.size());
+        flagged_pattern.append(flagstr);
+        flagged_pattern.append(pattern);
+        re = std::make_shared<const compiled_regex<char>>(flagged_pattern,
+                                                          opts);
+    }
+    if (!re->re.ok()) {
+        return unexpected_scan_error(scan_error::invalid_format_string,
+                                     "Failed to parse regular expression");
+    }
+    return re;
+#endif  // SCN_REGEX_BACKEND == ...
+}
+
+/**
+ * Bounded, thread-safe cache of compiled regular expressions,
+ * keyed by pattern and flags.
+ *
+ * Entries are kept in most-recently-used order,
+ * and the least recently used one is evicted when the cache is full.
+ * The capacity is small, so a linear search over the hashes is enough.
+ * An evicted regex stays alive until every scan still using it is done.
+ */
+template <typename CharT>
+class regex_cache {
+public:
+    static constexpr std::size_t capacity = SCN_REGEX_CACHE_SIZE;
+
+    compiled_regex_ptr<CharT> find(std::basic_string_view<CharT> pattern,
+                                   detail::regex_flags flags,
+                                   std::size_t hash)
+    {
+        std::lock_guard lock{m_mutex};
+        return find_and_touch(pattern, flags, hash);
+    }
+
+    /// If another thread has inserted the same regex first,
+    /// returns that one instead
+    compiled_regex_ptr<CharT> insert(std::basic_string_view<CharT> pattern,
+                                     detail::regex_flags flags,
+                                     std::size_t hash,
+                                     compiled_regex_ptr<CharT> re)
+    {
+        std::lock_guard lock{m_mutex};
+        if (auto existing = find_and_touch(pattern, flags, hash)) {
+            return existing;
+        }
+
+        if (m_entries.size() == capacity) {
+            m_entries.pop_back();
+        }
+        m_entries.insert(m_entries.begin(),
+                         entry{std::basic_string<CharT>{pattern}, flags, hash,
+                               re});
+        return re;
+    }
+
+private:
+    struct entry {
+        std::basic_string<CharT> pattern;
+        detail::regex_flags flags;
+        std::size_t hash;
+        compiled_regex_ptr<CharT> re;
+    };
+
+    compiled_regex_ptr<CharT> find_and_touch(
+        std::basic_string_view<CharT> pattern,
+        detail::regex_flags flags,
+        std::size_t hash)
+    {
+        auto it = std::find_if(
+            m_entries.begin(), m_entries.end(), [&](const entry& e) {
+                return e.hash == hash && e.flags == flags &&
+                       e.pattern == pattern;
+            });
+        if (it == m_entries.end()) {
+            return nullptr;
+        }
+        std::rotate(m_entries.begin(), it, it + 1);
+        return m_entries.front().re;
+    }
+
+    std::mutex m_mutex;
+    std::vector<entry> m_entries;
+};
 
+template <typename CharT>
+regex_cache<CharT>& get_regex_cache()
+{
+    static regex_cache<CharT> cache{};
+    return cache;
+}
+
+/**
+ * Returns a compiled regex for `pattern` and `flags`,
+ * only compiling it if it's not already cached.
+ */
+template <typename CharT>
+auto get_compiled_regex(std::basic_string_view<CharT> pattern,
+                        detail::regex_flags flags)
+    -> scan_expected<compiled_regex_ptr<CharT>>
+{
+    if constexpr (regex_cache<CharT>::capacity == 0) {
+        return compile_regex(pattern, flags);
+    }
+    else {
+        auto& cache = get_regex_cache<CharT>();
+        const auto hash = std::hash<std::basic_string_view<CharT>>{}(pattern);
+        if (auto re = cache.find(pattern, flags, hash)) {
+            return re;
+        }
+
+        // Compile outside of the lock, so that a slow compilation
+        // doesn't block threads using other, already cached regexes
+        SCN_TRY(re, compile_regex(pattern, flags));
+        return cache.insert(pattern, flags, hash, SCN_MOVE(re));
+    }
+}
+
+template <typename CharT, typename Input>
+auto read_regex_string_impl(std::basic_string_view<CharT> pattern,
+                            detail::regex_flags flags,
+                            Input input)
+    -> scan_expected<ranges::iterator_t<Input>>
+{
+    static_assert(ranges::contiguous_range<Input> &&
+                  ranges::borrowed_range<Input> &&
+                  std::is_same_v<ranges::range_value_t<Input>, CharT>);
+
+    // Only the extent of the match is needed, not the captures
+    SCN_TRY(compiled, get_compiled_regex(
+                          pattern, flags | detail::regex_flags::nocapture));
+    const auto& re = compiled->re;
+
+#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
     std::match_results<const CharT*> matches{};
     try {
         bool found = std::regex_search(input.data(),
@@ -162,23 +391,6 @@ auto read_regex_string_impl(std::basic_string_view<CharT> pattern,
 
     return input.begin() + ranges::distance(input.data(), matches[0].second);
 #elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_BOOST
-    auto re =
-#if SCN_REGEX_BOOST_USE_ICU
-        boost::make_u32regex(pattern.data(), pattern.data() + pattern.size(),
-                             make_regex_flags(flags) |
-                                 boost::regex_constants::no_except |
-                                 boost::regex_constants::nosubs);
-#else
-        boost::basic_regex<CharT>{pattern.data(), pattern.size(),
-                                  make_regex_flags(flags) |
-                                      boost::regex_constants::no_except |
-                                      boost::regex_constants::nosubs};
-#endif
-    if (re.status() != 0) {
-        return unexpected_scan_error(scan_error::invalid_format_string,
-                                     "Invalid regex");
-    }
-
     boost::match_results<const CharT*> matches{};
     try {
         bool found =
@@ -204,23 +416,6 @@ auto read_regex_string_impl(std::basic_string_view<CharT> pattern,
     return input.begin() + ranges::distance(input.data(), matches[0].second);
 #elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_RE2
     static_assert(std::is_same_v<CharT, char>);
-    std::string flagged_pattern{};
-    auto re = [&]() {
-        auto [opts, flagstr] = make_regex_flags(flags);
-        opts.set_never_capture(true);
-        if (flagstr.empty()) {
-            return re2::RE2{pattern, opts};
-        }
-        flagged_pattern.reserve(flagstr.size() + pattern.size());
-        flagged_pattern.append(flagstr);
-        flagged_pattern.append(pattern);
-        return re2::RE2{flagged_pattern, opts};
-    }();
-    if (!re.ok()) {
-        return unexpected_scan_error(scan_error::invalid_format_string,
-                                     "Failed to parse regular expression");
-    }
-
     auto new_input = detail::make_string_view_from_pointers(
         detail::to_address(input.begin()), detail::to_address(input.end()));
     bool found = re2::RE2::Consume(&new_input, re);
@@ -232,6 +427,192 @@ auto read_regex_string_impl(std::basic_string_view<CharT> pattern,
 #endif  // SCN_REGEX_BACKEND == ...
 }
 
+#if SCN_REGEX_SUPPORTS_NON_CONTIGUOUS_SOURCES
+/**
+ * Bidirectional view over a forward range, for matching a regex against
+ * a non-contiguous source, like `stdin`.
+ *
+ * Characters are read from the source only when the regex engine
+ * asks for them, and are kept in a buffer, so that the engine can
+ * backtrack. This gives the same result as matching against the entire
+ * source, while reading only as far as the engine looks.
+ */
+template <typename CharT, typename Iterator, typename Sentinel>
+class lazy_regex_input {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = CharT;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const CharT*;
+        using reference = const CharT&;
+
+        static constexpr std::size_t end_index =
+            std::numeric_limits<std::size_t>::max();
+
+        iterator() = default;
+        iterator(lazy_regex_input* input, std::size_t index)
+            : m_input(input), m_index(index)
+        {
+        }
+
+        reference operator*() const
+        {
+            SCN_EXPECT(!is_end());
+            return m_input->m_buffer[m_index];
+        }
+
+        iterator& operator++()
+        {
+            SCN_EXPECT(m_index != end_index);
+            ++m_index;
+            return *this;
+        }
+        iterator operator++(int)
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        iterator& operator--()
+        {
+            if (m_index == end_index) {
+                m_index = m_input->read_all();
+            }
+            SCN_EXPECT(m_index != 0);
+            --m_index;
+            return *this;
+        }
+        iterator operator--(int)
+        {
+            auto copy = *this;
+            --*this;
+            return copy;
+        }
+
+        friend bool operator==(const iterator& lhs, const iterator& rhs)
+        {
+            const bool lhs_end = lhs.is_end();
+            const bool rhs_end = rhs.is_end();
+            if (lhs_end || rhs_end) {
+                return lhs_end == rhs_end;
+            }
+            return lhs.m_index == rhs.m_index;
+        }
+        friend bool operator!=(const iterator& lhs, const iterator& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        /// Number of characters before this iterator in the source
+        std::size_t index() const
+        {
+            if (m_index == end_index) {
+                return m_input->read_all();
+            }
+            return m_index;
+        }
+
+    private:
+        bool is_end() const
+        {
+            return m_index == end_index || !m_input->read_until(m_index);
+        }
+
+        lazy_regex_input* m_input{nullptr};
+        std::size_t m_index{0};
+    };
+
+    lazy_regex_input(Iterator first, Sentinel last)
+        : m_it(SCN_MOVE(first)), m_end(SCN_MOVE(last))
+    {
+    }
+
+    lazy_regex_input(const lazy_regex_input&) = delete;
+    lazy_regex_input& operator=(const lazy_regex_input&) = delete;
+    lazy_regex_input(lazy_regex_input&&) = delete;
+    lazy_regex_input& operator=(lazy_regex_input&&) = delete;
+    ~lazy_regex_input() = default;
+
+    iterator begin()
+    {
+        return {this, 0};
+    }
+    iterator end()
+    {
+        return {this, iterator::end_index};
+    }
+
+private:
+    /// Reads from the source until the character at `index` is buffered.
+    /// Returns `false`, if the source ends before that.
+    bool read_until(std::size_t index)
+    {
+        while (m_buffer.size() <= index) {
+            if (m_it == m_end) {
+                return false;
+            }
+            m_buffer.push_back(*m_it);
+            ++m_it;
+        }
+        return true;
+    }
+
+    std::size_t read_all()
+    {
+        while (read_until(m_buffer.size())) {}
+        return m_buffer.size();
+    }
+
+    Iterator m_it;
+    Sentinel m_end;
+    std::basic_string<CharT> m_buffer{};
+};
+
+/**
+ * Like `read_regex_string_impl`, but for non-contiguous sources.
+ *
+ * Only the characters the regex engine looks at are read from the source
+ * and copied, so a pattern that doesn't match fails without reading
+ * the rest of the source.
+ */
+template <typename CharT, typename Range>
+auto read_regex_string_non_contiguous(std::basic_string_view<CharT> pattern,
+                                      detail::regex_flags flags,
+                                      Range&& range)
+    -> scan_expected<simple_borrowed_iterator_t<Range>>
+{
+    SCN_TRY(compiled, get_compiled_regex(
+                          pattern, flags | detail::regex_flags::nocapture));
+
+    lazy_regex_input<CharT, ranges::iterator_t<Range>,
+                     ranges::sentinel_t<Range>>
+        input{ranges::begin(range), ranges::end(range)};
+    using iterator = typename decltype(input)::iterator;
+
+    boost::match_results<iterator> matches{};
+    try {
+        bool found = boost::regex_search(
+            input.begin(), input.end(), matches, compiled->re,
+            boost::regex_constants::match_continuous);
+        if (!found || matches.prefix().matched) {
+            return unexpected_scan_error(scan_error::invalid_scanned_value,
+                                         "Regular expression didn't match");
+        }
+    }
+    catch (const std::runtime_error& err) {
+        return unexpected_scan_error(scan_error::invalid_format_string,
+                                     "Regex matching failed with an error");
+    }
+
+    return ranges_polyfill::batch_next(
+        ranges::begin(range),
+        static_cast<std::ptrdiff_t>(matches[0].second.index()));
+}
+#endif  // SCN_REGEX_SUPPORTS_NON_CONTIGUOUS_SOURCES
+
 template <typename CharT, typename Input>
 auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
                              detail::regex_flags flags,
@@ -243,17 +624,10 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
                   ranges::borrowed_range<Input> &&
                   std::is_same_v<ranges::range_value_t<Input>, CharT>);
 
-#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
-    std::basic_regex<CharT> re{};
-    try {
-        SCN_TRY(re_flags, make_regex_flags(flags));
-        re = std::basic_regex<CharT>{pattern.data(), pattern.size(), re_flags};
-    }
-    catch (const std::regex_error& err) {
-        return unexpected_scan_error(scan_error::invalid_format_string,
-                                     "Invalid regex");
-    }
+    SCN_TRY(compiled, get_compiled_regex(pattern, flags));
+    const auto& re = compiled->re;
 
+#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_STD
     std::match_results<const CharT*> matches{};
     try {
         bool found = std::regex_search(input.data(),
@@ -280,48 +654,6 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
         });
     return input.begin() + ranges::distance(input.data(), matches[0].second);
 #elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_BOOST
-    std::vector<std::basic_string<CharT>> names;
-    for (size_t i = 0; i < pattern.size();) {
-        if constexpr (std::is_same_v<CharT, char>) {
-            i = pattern.find("(?<", i);
-        }
-        else {
-            i = pattern.find(L"(?<", i);
-        }
-
-        if (i == std::basic_string_view<CharT>::npos) {
-            break;
-        }
-        if (i > 0 && pattern[i - 1] == CharT{'\\'}) {
-            if (i == 1 || pattern[i - 2] != CharT{'\\'}) {
-                i += 3;
-                continue;
-            }
-        }
-
-        i += 3;
-        auto end_i = pattern.find(CharT{'>'}, i);
-        if (end_i == std::basic_string_view<CharT>::npos) {
-            break;
-        }
-        names.emplace_back(pattern.substr(i, end_i - i));
-    }
-
-    auto re =
-#if SCN_REGEX_BOOST_USE_ICU
-        boost::make_u32regex(
-            pattern.data(), pattern.data() + pattern.size(),
-            make_regex_flags(flags) | boost::regex_constants::no_except);
-#else
-        boost::basic_regex<CharT>{
-            pattern.data(), pattern.size(),
-            make_regex_flags(flags) | boost::regex_constants::no_except};
-#endif
-    if (re.status() != 0) {
-        return unexpected_scan_error(scan_error::invalid_format_string,
-                                     "Invalid regex");
-    }
-
     boost::match_results<const CharT*> matches{};
     try {
         bool found =
@@ -347,44 +679,35 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
     value.resize(matches.size());
     ranges::transform(
         matches, value.begin(),
-        [&](auto&& match) -> std::optional<basic_regex_match<CharT>> {
+        [](auto&& match) -> std::optional<basic_regex_match<CharT>> {
             if (!match.matched)
                 return std::nullopt;
-            auto sv = detail::make_string_view_from_pointers(match.first,
-                                                             match.second);
-
-            if (auto name_it = ranges::find_if(
-                    names,
-                    [&](const auto& name) { return match == matches[name]; });
-                name_it != names.end()) {
-                return basic_regex_match<CharT>{sv, *name_it};
-            }
-            return sv;
+            return detail::make_string_view_from_pointers(match.first,
+                                                          match.second);
         });
+    for_each_regex_capture_name(pattern, [&](auto name) {
+        const auto idx = matches.named_subexpression_index(
+            name.data(), name.data() + name.size());
+        if (idx > 0 && static_cast<size_t>(idx) < value.size() &&
+            value[static_cast<size_t>(idx)]) {
+            auto& match = value[static_cast<size_t>(idx)];
+            match.emplace(match->get(), std::basic_string<CharT>{name});
+        }
+    });
     return input.begin() + ranges::distance(input.data(), matches[0].second);
 #elif SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_RE2
     static_assert(std::is_same_v<CharT, char>);
-    std::string flagged_pattern{};
-    auto re = [&]() {
-        auto [opts, flagstr] = make_regex_flags(flags);
-        if (flagstr.empty()) {
-            return re2::RE2{pattern, opts};
-        }
-        flagged_pattern.reserve(flagstr.size() + pattern.size());
-        flagged_pattern.append(flagstr);
-        flagged_pattern.append(pattern);
-        return re2::RE2{flagged_pattern, opts};
-    }();
-    if (!re.ok()) {
-        return unexpected_scan_error(scan_error::invalid_format_string,
-                                     "Failed to parse regular expression");
-    }
-    // TODO: Optimize into a single batch allocation
+    // Stored inline for the common case of a few capture groups
+    using matches_type =
+        detail::small_vector<std::optional<std::string_view>,
+                             basic_regex_matches<CharT>::inline_capacity>;
     const auto max_matches_n =
         static_cast<size_t>(re.NumberOfCapturingGroups());
-    std::vector<std::optional<std::string_view>> matches(max_matches_n);
-    std::vector<re2::RE2::Arg> match_args(max_matches_n);
-    std::vector<re2::RE2::Arg*> match_argptrs(max_matches_n);
+    matches_type matches(max_matches_n);
+    detail::small_vector<re2::RE2::Arg, matches_type::inline_capacity>
+        match_args(max_matches_n);
+    detail::small_vector<re2::RE2::Arg*, matches_type::inline_capacity>
+        match_argptrs(max_matches_n);
     ranges::transform(matches, match_args.begin(),
                       [](auto& val) { return re2::RE2::Arg{&val}; });
     ranges::transform(match_args, match_argptrs.begin(),
@@ -409,11 +732,13 @@ auto read_regex_matches_impl(std::basic_string_view<CharT> pattern,
     {
         const auto& capturing_groups = re.CapturingGroupNames();
         for (size_t i = 1; i < value.size(); ++i) {
+            if (!value[i]) {
+                continue;
+            }
             if (auto it = capturing_groups.find(static_cast<int>(i));
                 it != capturing_groups.end()) {
-                auto val = value[i]->get();
-                value[i].emplace(val, it->second);
-            };
+                value[i].emplace(value[i]->get(), it->second);
+            }
         }
     }
     return input.begin() + ranges::distance(input.data(), new_input.data());
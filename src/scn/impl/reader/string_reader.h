@@ -31,24 +31,85 @@ namespace scn {
 SCN_BEGIN_NAMESPACE
 
 namespace impl {
+template <typename CharT>
+bool validate_scanned_string(std::basic_string_view<CharT> str,
+                             encoding_validation_cache<CharT>* cache)
+{
+    if (cache) {
+        return cache->validate(str);
+    }
+    return validate_unicode(str);
+}
+
+template <typename SourceCharT, typename ValueCharT>
+scan_error transcode_scanned_string(
+    std::basic_string_view<SourceCharT> src,
+    std::basic_string<ValueCharT>& value,
+    encoding_validation_cache<SourceCharT>* cache)
+{
+    static_assert(!std::is_same_v<SourceCharT, ValueCharT>);
+
+    if (!validate_scanned_string(src, cache)) {
+        return {scan_error::invalid_scanned_value,
+                "Invalid encoding in scanned string"};
+    }
+
+    if (cache && cache->is_ascii(src)) {
+        // Every code unit is a code point, widen them one by one
+        value.assign(src.begin(), src.end());
+    }
+    else {
+        // Sized exactly up front, reuses the capacity of `value`
+        transcode_valid_to_string(src, value);
+    }
+    return {};
+}
+
 template <typename Range, typename Iterator, typename ValueCharT>
-auto read_string_impl(Range& range,
-                      Iterator&& result,
-                      std::basic_string<ValueCharT>& value)
+auto read_string_impl(
+    Range& range,
+    Iterator&& result,
+    std::basic_string<ValueCharT>& value,
+    encoding_validation_cache<detail::char_t<Range>>* cache = nullptr,
+    std::basic_string<detail::char_t<Range>>* transcode_scratch = nullptr)
     -> scan_expected<ranges::iterator_t<Range&>>
 {
     static_assert(
         ranges_std::forward_iterator<detail::remove_cvref_t<Iterator>>);
 
+    using src_char_type = detail::char_t<Range>;
+    if constexpr (!std::is_same_v<src_char_type, ValueCharT>) {
+        if (transcode_scratch) {
+            // The intermediate copy of a non-contiguous source
+            // is thrown away after transcoding, so reuse a buffer for it
+            const auto src = make_contiguous_view_with_scratch(
+                ranges::subrange{ranges::begin(range), result},
+                *transcode_scratch);
+            if (auto e = transcode_scanned_string(src, value, cache);
+                SCN_UNLIKELY(!e)) {
+                return unexpected(e);
+            }
+            return SCN_MOVE(result);
+        }
+    }
+
     auto src =
         make_contiguous_buffer(ranges::subrange{ranges::begin(range), result});
-    if (!validate_unicode(src.view())) {
-        return unexpected_scan_error(scan_error::invalid_scanned_value,
-                                     "Invalid encoding in scanned string");
+    if constexpr (std::is_same_v<src_char_type, ValueCharT>) {
+        if (!validate_scanned_string(src.view(), cache)) {
+            return unexpected_scan_error(scan_error::invalid_scanned_value,
+                                         "Invalid encoding in scanned string");
+        }
+        if (auto e = transcode_if_necessary(SCN_MOVE(src), value);
+            SCN_UNLIKELY(!e)) {
+            return unexpected(e);
+        }
     }
-    if (auto e = transcode_if_necessary(SCN_MOVE(src), value);
-        SCN_UNLIKELY(!e)) {
-        return unexpected(e);
+    else {
+        if (auto e = transcode_scanned_string(src.view(), value, cache);
+            SCN_UNLIKELY(!e)) {
+            return unexpected(e);
+        }
     }
 
     return SCN_MOVE(result);
@@ -57,7 +118,9 @@ auto read_string_impl(Range& range,
 template <typename Range, typename Iterator, typename ValueCharT>
 auto read_string_view_impl(Range& range,
                            Iterator&& result,
-                           std::basic_string_view<ValueCharT>& value)
+                           std::basic_string_view<ValueCharT>& value,
+                           encoding_validation_cache<detail::char_t<Range>>*
+                               cache = nullptr)
     -> scan_expected<ranges::iterator_t<Range&>>
 {
     static_assert(
@@ -92,7 +155,7 @@ auto read_string_view_impl(Range& range,
         value = std::basic_string_view<ValueCharT>(
             ranges::data(view), ranges_polyfill::usize(view));
 
-        if (!validate_unicode(value)) {
+        if (!validate_scanned_string(value, cache)) {
             return unexpected_scan_error(
                 scan_error::invalid_scanned_value,
                 "Invalid encoding in scanned string_view");
@@ -110,7 +173,8 @@ public:
         Range&& range,
         std::basic_string<ValueCharT>& value)
     {
-        return read_string_impl(range, read_until_classic_space(range), value);
+        return read_string_impl(range, read_until_classic_space(range), value,
+                                validation_cache, transcode_scratch);
     }
 
     template <typename Range, typename ValueCharT>
@@ -119,8 +183,11 @@ public:
         std::basic_string_view<ValueCharT>& value)
     {
         return read_string_view_impl(range, read_until_classic_space(range),
-                                     value);
+                                     value, validation_cache);
     }
+
+    encoding_validation_cache<SourceCharT>* validation_cache{nullptr};
+    std::basic_string<SourceCharT>* transcode_scratch{nullptr};
 };
 
 #if !SCN_DISABLE_REGEX
@@ -135,7 +202,7 @@ public:
         std::basic_string<ValueCharT>& value)
     {
         SCN_TRY(it, impl(range, pattern, flags));
-        return read_string_impl(range, it, value);
+        return read_string_impl(range, it, value, validation_cache);
     }
 
     template <typename Range, typename ValueCharT>
@@ -146,9 +213,11 @@ public:
         std::basic_string_view<ValueCharT>& value)
     {
         SCN_TRY(it, impl(range, pattern, flags));
-        return read_string_view_impl(range, it, value);
+        return read_string_view_impl(range, it, value, validation_cache);
     }
 
+    encoding_validation_cache<SourceCharT>* validation_cache{nullptr};
+
 private:
     template <typename Range>
     auto impl(Range&& range,
@@ -164,10 +233,15 @@ private:
         }
         else {
             if (!is_entire_source_contiguous(range)) {
+#if SCN_REGEX_SUPPORTS_NON_CONTIGUOUS_SOURCES
+                return read_regex_string_non_contiguous(pattern, flags,
+                                                        range);
+#else
                 return unexpected_scan_error(
                     scan_error::invalid_scanned_value,
                     "Cannot use regex with a non-contiguous source "
                     "range");
+#endif
             }
 
             auto input = get_as_contiguous(range);
@@ -186,50 +260,31 @@ public:
     // Note: no localized version,
     // since it's equivalent in behavior
 
+    // 'c' requires a field width, and `range` has already been limited to
+    // it, so all of `range` is read
+
     template <typename Range, typename ValueCharT>
     auto read(Range&& range, std::basic_string<ValueCharT>& value)
         -> scan_expected<simple_borrowed_iterator_t<Range>>
     {
-        return read_impl(
-            range,
-            [&](auto&& rng) {
-                return read_string_impl(rng, read_all(rng), value);
-            },
-            detail::priority_tag<1>{});
+        return read_string_impl(range, read_all(range), value,
+                                validation_cache, transcode_scratch);
     }
 
     template <typename Range, typename ValueCharT>
     auto read(Range&& range, std::basic_string_view<ValueCharT>& value)
         -> scan_expected<simple_borrowed_iterator_t<Range>>
     {
-        return read_impl(
-            range,
-            [&](auto&& rng) {
-                return read_string_view_impl(rng, read_all(rng), value);
-            },
-            detail::priority_tag<1>{});
+        return read_string_view_impl(range, read_all(range), value,
+                                     validation_cache);
     }
 
-private:
-    template <typename View, typename ReadCb>
-    static auto read_impl(take_width_view<View>& range,
-                          ReadCb&& read_cb,
-                          detail::priority_tag<1>)
-        -> scan_expected<simple_borrowed_iterator_t<take_width_view<View>&>>
-    {
-        return read_cb(range);
-    }
-
-    template <typename Range, typename ReadCb>
-    static auto read_impl(Range&&, ReadCb&&, detail::priority_tag<0>)
-        -> scan_expected<simple_borrowed_iterator_t<Range>>
-    {
-        return unexpected_scan_error(
-            scan_error::invalid_scanned_value,
-            "character_reader requires take_width_view");
-    }
+    encoding_validation_cache<SourceCharT>* validation_cache{nullptr};
+    std::basic_string<SourceCharT>* transcode_scratch{nullptr};
 };
 
+using charset_range = std::pair<char32_t, char32_t>;
+
 struct nonascii_specs_handler {
     void on_charset_single(char32_t cp)
     {
@@ -242,20 +297,31 @@ struct nonascii_specs_handler {
             return;
         }
 
-        for (auto& elem : extra_ranges) {
-            // TODO: check for overlap
-            if (elem.first == end) {
-                elem.first = begin;
-                return;
-            }
+        // Merged with the other ranges in `finalize()`
+        extra_ranges.push_back(std::make_pair(begin, end));
+    }
 
-            if (elem.second == begin) {
-                elem.second = end;
-                return;
-            }
+    /// Sorts `extra_ranges`, and merges overlapping and adjacent ranges,
+    /// so that they can be binary searched
+    void finalize()
+    {
+        if (extra_ranges.empty()) {
+            return;
         }
 
-        extra_ranges.push_back(std::make_pair(begin, end));
+        ranges::sort(extra_ranges);
+        auto out = extra_ranges.begin();
+        for (auto it = extra_ranges.begin() + 1; it != extra_ranges.end();
+             ++it) {
+            if (static_cast<uint32_t>(it->first) <=
+                static_cast<uint32_t>(out->second)) {
+                out->second = (std::max)(out->second, it->second);
+            }
+            else {
+                *++out = *it;
+            }
+        }
+        extra_ranges.erase(out + 1, extra_ranges.end());
     }
 
     constexpr void on_charset_inverted() const
@@ -278,10 +344,55 @@ struct nonascii_specs_handler {
         return static_cast<bool>(err);
     }
 
-    std::vector<std::pair<char32_t, char32_t>> extra_ranges;
+    std::vector<charset_range>& extra_ranges;
     scan_error err;
 };
 
+/**
+ * Parses the non-ASCII members of the character set in `specs` into
+ * `ranges`, sorted and merged, so that they can be looked up with
+ * `charset_ranges_contain`.
+ */
+template <typename CharT>
+scan_error compile_nonascii_charset(const detail::format_specs& specs,
+                                    std::vector<charset_range>& ranges)
+{
+    SCN_EXPECT(specs.charset_has_nonascii);
+
+    ranges.clear();
+    nonascii_specs_handler handler{ranges, {}};
+    auto charset_string = specs.charset_string<CharT>();
+    auto it = detail::to_address(charset_string.begin());
+    auto set = detail::parse_presentation_set(
+        it, detail::to_address(charset_string.end()), handler);
+    if (SCN_UNLIKELY(!handler)) {
+        return handler.err;
+    }
+    SCN_ENSURE(it == detail::to_address(charset_string.end()));
+    SCN_ENSURE(set == charset_string);
+
+    handler.finalize();
+    return {};
+}
+
+inline bool charset_ranges_contain(const charset_range* first,
+                                   const charset_range* last,
+                                   char32_t cp)
+{
+    // First range starting after `cp`, `cp` can only be in the one before
+    const auto it = std::upper_bound(
+        first, last, cp,
+        [](char32_t val, const charset_range& range) {
+            return static_cast<uint32_t>(val) <
+                   static_cast<uint32_t>(range.first);
+        });
+    if (it == first) {
+        return false;
+    }
+    return static_cast<uint32_t>(cp) <
+           static_cast<uint32_t>(std::prev(it)->second);
+}
+
 template <typename SourceCharT>
 class character_set_reader_impl {
 public:
@@ -296,7 +407,8 @@ public:
             return unexpected(it.error());
         }
 
-        return read_string_impl(range, *it, value);
+        return read_string_impl(range, *it, value, validation_cache,
+                                transcode_scratch);
     }
 
     template <typename Range, typename ValueCharT>
@@ -310,12 +422,16 @@ public:
             return unexpected(it.error());
         }
 
-        return read_string_view_impl(range, *it, value);
+        return read_string_view_impl(range, *it, value,
+                                     validation_cache);
     }
 
+    encoding_validation_cache<SourceCharT>* validation_cache{nullptr};
+    std::basic_string<SourceCharT>* transcode_scratch{nullptr};
+
 private:
     struct specs_helper {
-        constexpr specs_helper(const detail::format_specs& s) : specs(s) {}
+        specs_helper(const detail::format_specs& s) : specs(s) {}
 
         constexpr bool is_char_set_in_literals(char ch) const
         {
@@ -329,18 +445,8 @@ private:
 
         bool is_char_set_in_extra_literals(char32_t cp) const
         {
-            // TODO: binary search?
-            if (nonascii.extra_ranges.empty()) {
-                return false;
-            }
-
-            const auto cp_val = static_cast<uint32_t>(cp);
-            return ranges::find_if(
-                       nonascii.extra_ranges,
-                       [cp_val](const auto& pair) SCN_NOEXCEPT {
-                           return static_cast<uint32_t>(pair.first) <= cp_val &&
-                                  static_cast<uint32_t>(pair.second) > cp_val;
-                       }) != nonascii.extra_ranges.end();
+            return charset_ranges_contain(
+                extra_ranges, extra_ranges + extra_ranges_size, cp);
         }
 
         scan_error handle_nonascii()
@@ -349,22 +455,28 @@ private:
                 return {};
             }
 
-            auto charset_string = specs.charset_string<SourceCharT>();
-            auto it = detail::to_address(charset_string.begin());
-            auto set = detail::parse_presentation_set(
-                it, detail::to_address(charset_string.end()), nonascii);
-            if (SCN_UNLIKELY(!nonascii)) {
-                return nonascii.err;
+            if (specs.charset_nonascii_ranges) {
+                // Compiled when the format string was parsed
+                extra_ranges = specs.charset_nonascii_ranges;
+                extra_ranges_size = specs.charset_nonascii_ranges_size;
+                return {};
             }
-            SCN_ENSURE(it == detail::to_address(charset_string.end()));
-            SCN_ENSURE(set == charset_string);
 
-            ranges::sort(nonascii.extra_ranges);
+            if (auto e = compile_nonascii_charset<SourceCharT>(specs,
+                                                               owned_ranges);
+                SCN_UNLIKELY(!e)) {
+                return e;
+            }
+            extra_ranges = owned_ranges.data();
+            extra_ranges_size = owned_ranges.size();
             return {};
         }
 
         const detail::format_specs& specs;
-        nonascii_specs_handler nonascii;
+        const charset_range* extra_ranges{nullptr};
+        std::size_t extra_ranges_size{0};
+        // Used if the ranges weren't compiled with the format string
+        std::vector<charset_range> owned_ranges{};
     };
 
     struct read_source_callback {
@@ -402,6 +514,30 @@ private:
             return unexpected(e);
         }
 
+        if constexpr (ranges::contiguous_range<Range> &&
+                      ranges::sized_range<Range> &&
+                      std::is_same_v<SourceCharT, char>) {
+            if (accepts_nonascii && validation_cache &&
+                validation_cache->is_ascii_hinted()) {
+                // Read as if the source was ASCII, and check afterwards
+                // that it was, including the code unit the read stopped at
+                auto it = read_source_narrow_fast(range, helper, true);
+                const auto checked_end =
+                    it == ranges::end(range) ? it : ranges::next(it);
+                if (validation_cache->is_ascii(std::string_view{
+                        ranges::data(range),
+                        static_cast<std::size_t>(
+                            ranges::distance(ranges::begin(range),
+                                             checked_end))})) {
+                    return check_nonempty(it, range);
+                }
+            }
+            if (!accepts_nonascii || !is_inverted) {
+                return check_nonempty(
+                    read_source_narrow_fast(range, helper, false), range);
+            }
+        }
+
         read_source_callback cb_wrapper{helper};
 
         if (accepts_nonascii) {
@@ -429,6 +565,57 @@ private:
         return check_nonempty(it, range);
     }
 
+    /**
+     * Reads the ASCII members of the set with a vectorized search.
+     * Non-ASCII code points only need to be decoded if the set has
+     * non-ASCII members, and they are only looked at when the
+     * search stops at one.
+     * In an ASCII source, the non-ASCII members can be ignored altogether.
+     */
+    template <typename Range>
+    static simple_borrowed_iterator_t<Range> read_source_narrow_fast(
+        Range&& range,
+        const specs_helper& helper,
+        bool is_ascii_source)
+    {
+        const auto source =
+            std::string_view{ranges::data(range), ranges_polyfill::usize(range)};
+        const auto& charset = helper.specs.charset_literals;
+
+        auto make_result = [&](std::string_view::iterator it) {
+            return ranges::begin(range) + ranges::distance(source.begin(), it);
+        };
+
+        if (helper.specs.charset_is_inverted) {
+            SCN_EXPECT(!helper.specs.charset_has_nonascii || is_ascii_source);
+            return make_result(
+                find_ascii_charset_member_narrow_fast(source, charset));
+        }
+
+        auto it = source.begin();
+        while (true) {
+            it = detail::make_string_view_iterator(
+                source, find_ascii_charset_nonmember_narrow_fast(
+                            detail::make_string_view_from_iterators<char>(
+                                it, source.end()),
+                            charset));
+            if (!helper.specs.charset_has_nonascii || is_ascii_source ||
+                it == source.end() || is_ascii_char(*it)) {
+                break;
+            }
+
+            const auto rest =
+                detail::make_string_view_from_iterators<char>(it, source.end());
+            const auto [next, cp] = get_next_code_point(rest);
+            if (cp == detail::invalid_code_point ||
+                !helper.is_char_set_in_extra_literals(cp)) {
+                break;
+            }
+            it = detail::make_string_view_iterator(source, next);
+        }
+        return make_result(it);
+    }
+
     template <typename Iterator, typename Range>
     static scan_expected<Iterator> check_nonempty(const Iterator& it,
                                                   const Range& range)
@@ -494,12 +681,24 @@ public:
         return m_type == reader_type::word;
     }
 
+    void set_validation_cache(encoding_validation_cache<SourceCharT>* cache)
+    {
+        m_validation_cache = cache;
+    }
+
+    void set_transcode_scratch(std::basic_string<SourceCharT>* scratch)
+    {
+        m_transcode_scratch = scratch;
+    }
+
     template <typename Range, typename Value>
     scan_expected<simple_borrowed_iterator_t<Range>>
     read_default(Range&& range, Value& value, detail::locale_ref loc)
     {
         SCN_UNUSED(loc);
-        return word_reader_impl<SourceCharT>{}.read(SCN_FWD(range), value);
+        return word_reader_impl<SourceCharT>{m_validation_cache,
+                                             m_transcode_scratch}
+            .read(SCN_FWD(range), value);
     }
 
     template <typename Range, typename Value>
@@ -531,29 +730,34 @@ protected:
 
         switch (m_type) {
             case reader_type::word:
-                return word_reader_impl<SourceCharT>{}.read(SCN_FWD(range),
-                                                            value);
+                return word_reader_impl<SourceCharT>{m_validation_cache,
+                                                     m_transcode_scratch}
+                    .read(SCN_FWD(range), value);
 
             case reader_type::character:
-                return character_reader_impl<SourceCharT>{}.read(SCN_FWD(range),
-                                                                 value);
+                return character_reader_impl<SourceCharT>{
+                    m_validation_cache, m_transcode_scratch}
+                    .read(SCN_FWD(range), value);
 
             case reader_type::character_set:
-                return character_set_reader_impl<SourceCharT>{}.read(
-                    SCN_FWD(range), specs, value);
+                return character_set_reader_impl<SourceCharT>{
+                    m_validation_cache, m_transcode_scratch}
+                    .read(SCN_FWD(range), specs, value);
 
 #if !SCN_DISABLE_REGEX
             case reader_type::regex:
-                return regex_string_reader_impl<SourceCharT>{}.read(
-                    SCN_FWD(range), specs.charset_string<SourceCharT>(),
-                    specs.regexp_flags, value);
+                return regex_string_reader_impl<SourceCharT>{
+                    m_validation_cache}
+                    .read(SCN_FWD(range), specs.charset_string<SourceCharT>(),
+                          specs.regexp_flags, value);
 
             case reader_type::regex_escaped:
-                return regex_string_reader_impl<SourceCharT>{}.read(
-                    SCN_FWD(range),
-                    get_unescaped_regex_pattern(
-                        specs.charset_string<SourceCharT>()),
-                    specs.regexp_flags, value);
+                return regex_string_reader_impl<SourceCharT>{
+                    m_validation_cache}
+                    .read(SCN_FWD(range),
+                          get_unescaped_regex_pattern(
+                              specs.charset_string<SourceCharT>()),
+                          specs.regexp_flags, value);
 #endif
 
             default:
@@ -565,6 +769,8 @@ protected:
     }
 
     reader_type m_type{reader_type::word};
+    encoding_validation_cache<SourceCharT>* m_validation_cache{nullptr};
+    std::basic_string<SourceCharT>* m_transcode_scratch{nullptr};
 };
 
 template <typename SourceCharT>
@@ -26,6 +26,7 @@
 #include <scn/util/string_view.h>
 
 #include <cstdint>
+#include <functional>
 #include <optional>
 
 SCN_GCC_PUSH
@@ -104,12 +105,215 @@ bool validate_unicode(std::basic_string_view<CharT> input)
     }
 }
 
+/// `true`, if `input` only contains 7-bit ASCII
+inline bool validate_ascii(std::string_view input)
+{
+    return simdutf::validate_ascii(input.data(), input.size());
+}
+
 template <typename CharT>
 std::size_t code_point_length_by_starting_code_unit(CharT ch)
 {
     return detail::utf_code_point_length_by_starting_code_unit(ch);
 }
 
+/**
+ * Validates the encoding of tokens scanned from a single contiguous source,
+ * without validating the same code units more than once.
+ *
+ * Instead of validating every token separately, the source is validated
+ * in chunks, keeping track of a watermark, under which the source is known to
+ * be valid. Tokens below the watermark need no further validation.
+ * The chunks grow geometrically, so that scanning only a few values from the
+ * beginning of a large source doesn't validate all of it.
+ *
+ * Tokens outside of the source given in the constructor
+ * (e.g. copied out of a non-contiguous source) are validated separately.
+ */
+template <typename CharT>
+class encoding_validation_cache {
+public:
+    static constexpr std::size_t initial_chunk_size = 64;
+    static constexpr std::size_t max_chunk_size = 64 * 1024;
+
+    /// Validates every token separately
+    constexpr encoding_validation_cache() = default;
+
+    explicit constexpr encoding_validation_cache(
+        std::basic_string_view<CharT> source)
+        : m_source_begin(source.data()),
+          m_source_end(source.data() + source.size()),
+          m_valid_end(source.data())
+    {
+    }
+
+    /// Trusts every token to be valid, see `scn::assume_valid_utf8`
+    static constexpr encoding_validation_cache assume_valid()
+    {
+        encoding_validation_cache cache{};
+        cache.m_assume_valid = true;
+        return cache;
+    }
+
+    /**
+     * `source` is expected to only contain ASCII, see `scn::ascii_source`.
+     * That's checked lazily, only for the parts of `source` tokens are
+     * read from, in geometrically growing chunks like the encoding.
+     * Once the check fails, tokens are validated as if this was constructed
+     * with `source`, or not at all, if `assume_valid` is set.
+     */
+    static constexpr encoding_validation_cache ascii_hinted(
+        std::basic_string_view<CharT> source,
+        bool assume_valid)
+    {
+        encoding_validation_cache cache{source};
+        cache.m_assume_valid = assume_valid;
+        cache.m_ascii_hint = true;
+        cache.m_ascii_end = source.data();
+        return cache;
+    }
+
+    SCN_NODISCARD constexpr bool assumes_valid() const
+    {
+        return m_assume_valid;
+    }
+
+    /**
+     * `true`, if the source is still expected to only contain ASCII.
+     * Tokens read assuming that have to be checked with `is_ascii`.
+     */
+    SCN_NODISCARD constexpr bool is_ascii_hinted() const
+    {
+        return m_ascii_hint;
+    }
+
+    /// `true`, if `token` is known to only contain ASCII
+    SCN_NODISCARD bool is_ascii(std::basic_string_view<CharT> token)
+    {
+        if (!m_ascii_hint) {
+            return false;
+        }
+
+        const auto* token_begin = token.data();
+        const auto* token_end = token.data() + token.size();
+        if (!is_in_source(token_begin, token_end)) {
+            return false;
+        }
+        if (token_end <= m_ascii_end) {
+            return true;
+        }
+
+        if (!extend_ascii_range(token_end)) {
+            SCN_UNLIKELY_ATTR
+            m_ascii_hint = false;
+            return false;
+        }
+        return true;
+    }
+
+    SCN_NODISCARD bool validate(std::basic_string_view<CharT> token)
+    {
+        if (m_assume_valid || token.empty() || is_ascii(token)) {
+            return true;
+        }
+
+        const auto* token_begin = token.data();
+        const auto* token_end = token.data() + token.size();
+        if (!is_in_source(token_begin, token_end) ||
+            (m_valid_begin != nullptr && token_begin < m_valid_begin)) {
+            return validate_unicode(token);
+        }
+        if (token_end <= m_valid_end) {
+            return true;
+        }
+
+        if (m_valid_begin == nullptr) {
+            m_valid_begin = token_begin;
+            m_valid_end = token_begin;
+        }
+        if (!extend_valid_range(token_end)) {
+            SCN_UNLIKELY_ATTR
+            // Stop caching, the error may well be outside of this token
+            m_source_begin = m_source_end = nullptr;
+            return validate_unicode(token);
+        }
+        return true;
+    }
+
+private:
+    /// Tokens may point into other buffers, like a transcoding scratch
+    /// buffer, so they're compared with `std::less`, which is defined for
+    /// unrelated pointers. Once a token is known to be in the source,
+    /// the built-in operators can be used.
+    bool is_in_source(const CharT* token_begin, const CharT* token_end) const
+    {
+        return m_source_begin != nullptr &&
+               !std::less<>{}(token_begin, m_source_begin) &&
+               !std::less<>{}(m_source_end, token_end);
+    }
+
+    bool extend_valid_range(const CharT* token_end)
+    {
+        const auto available =
+            static_cast<std::size_t>(m_source_end - m_valid_end);
+        auto* chunk_end = m_valid_end + (std::min)(m_chunk_size, available);
+        if (chunk_end < token_end) {
+            chunk_end = token_end;
+        }
+        // Don't cut a code point in half
+        while (chunk_end != token_end && chunk_end != m_source_end &&
+               code_point_length_by_starting_code_unit(*chunk_end) == 0) {
+            --chunk_end;
+        }
+
+        if (!validate_unicode(detail::make_string_view_from_pointers(
+                m_valid_end, chunk_end))) {
+            return false;
+        }
+
+        m_valid_end = chunk_end;
+        m_chunk_size = (std::min)(m_chunk_size * 2, max_chunk_size);
+        return true;
+    }
+
+    bool extend_ascii_range(const CharT* token_end)
+    {
+        if constexpr (std::is_same_v<CharT, char>) {
+            const auto available =
+                static_cast<std::size_t>(m_source_end - m_ascii_end);
+            auto* chunk_end =
+                m_ascii_end + (std::min)(m_ascii_chunk_size, available);
+            if (chunk_end < token_end) {
+                chunk_end = token_end;
+            }
+
+            if (!validate_ascii(detail::make_string_view_from_pointers(
+                    m_ascii_end, chunk_end))) {
+                return false;
+            }
+
+            m_ascii_end = chunk_end;
+            m_ascii_chunk_size =
+                (std::min)(m_ascii_chunk_size * 2, max_chunk_size);
+            return true;
+        }
+        else {
+            SCN_UNUSED(token_end);
+            return false;
+        }
+    }
+
+    const CharT* m_source_begin{nullptr};
+    const CharT* m_source_end{nullptr};
+    const CharT* m_valid_begin{nullptr};
+    const CharT* m_valid_end{nullptr};
+    const CharT* m_ascii_end{nullptr};
+    std::size_t m_chunk_size{initial_chunk_size};
+    std::size_t m_ascii_chunk_size{initial_chunk_size};
+    bool m_assume_valid{false};
+    bool m_ascii_hint{false};
+};
+
 template <typename CharT>
 char32_t decode_code_point_exhaustive(std::basic_string_view<CharT> input)
 {
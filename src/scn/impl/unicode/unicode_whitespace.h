@@ -47,8 +47,12 @@ template <typename CharT>
 inline auto is_first_char_space(std::basic_string_view<CharT> str)
     -> is_first_char_space_result<CharT>
 {
-    // TODO: optimize
     SCN_EXPECT(!str.empty());
+    if (is_ascii_char(str.front())) {
+        // A code point of its own, no need to decode
+        return {str.begin() + 1, static_cast<char32_t>(str.front()),
+                is_ascii_space(str.front())};
+    }
     auto res = get_next_code_point(str);
     return {res.iterator, res.value, is_cp_space(res.value)};
 }
@@ -72,6 +72,35 @@ inline int count_trailing_zeroes(uint64_t val)
 #define SCN_HAS_BITS_CTZ 1
 #endif
 
+inline int count_leading_zeroes(uint64_t val)
+{
+    SCN_EXPECT(val != 0);
+#if SCN_HAS_BITOPS
+    return std::countl_zero(val);
+#elif SCN_GCC_COMPAT
+    return __builtin_clzll(val);
+#elif SCN_MSVC && SCN_WINDOWS_64BIT
+    DWORD ret{};
+    _BitScanReverse64(&ret, val);
+    return 63 - static_cast<int>(ret);
+#elif SCN_MSVC && !SCN_WINDOWS_64BIT
+    DWORD ret{};
+    if (_BitScanReverse(&ret, static_cast<uint32_t>(val >> 32))) {
+        return 31 - static_cast<int>(ret);
+    }
+
+    _BitScanReverse(&ret, static_cast<uint32_t>(val));
+    return 63 - static_cast<int>(ret);
+#else
+    int ret = 0;
+    while ((val & (1ull << 63)) == 0) {
+        val <<= 1;
+        ++ret;
+    }
+    return ret;
+#endif
+}
+
 constexpr uint64_t has_zero_byte(uint64_t word)
 {
     return (word - 0x0101010101010101ull) & ~word & 0x8080808080808080ull;
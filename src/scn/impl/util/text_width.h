@@ -17,9 +17,12 @@
 
 #pragma once
 
+#include <scn/impl/algorithms/find_whitespace.h>
 #include <scn/impl/locale.h>
 #include <scn/impl/unicode/unicode.h>
+#include <scn/impl/util/ascii_ctype.h>
 
+#include <algorithm>
 #include <array>
 #include <iterator>
 
@@ -74,29 +77,160 @@ enum class text_width_algorithm {
 inline constexpr auto default_text_width_algorithm =
     text_width_algorithm::fmt_latest;
 
+/// Inclusive range of code points
+struct code_point_range {
+    char32_t first;
+    char32_t last;
+};
+
+/**
+ * Code points with a width of 2 with `text_width_algorithm::fmt_v10`,
+ * every other code point has a width of 1.
+ */
+inline constexpr std::array<code_point_range, 14> fmt_v10_wide_ranges = {{
+    {0x1100, 0x115f},    // Hangul Jamo init. consonants
+    {0x2329, 0x232a},    // LEFT- and RIGHT-POINTING ANGLE BRACKET
+    {0x2e80, 0x303e},    // CJK ... Yi except IDEOGRAPHIC HALF FILL SPACE
+    {0x3040, 0xa4cf},    // (U+303F)
+    {0xac00, 0xd7a3},    // Hangul Syllables
+    {0xf900, 0xfaff},    // CJK Compatibility Ideographs
+    {0xfe10, 0xfe19},    // Vertical Forms
+    {0xfe30, 0xfe6f},    // CJK Compatibility Forms
+    {0xff00, 0xff60},    // Fullwidth Forms
+    {0xffe0, 0xffe6},    // Fullwidth Forms
+    {0x1f300, 0x1f64f},  // Miscellaneous Symbols and Pictographs + Emoticons
+    {0x1f900, 0x1f9ff},  // Supplemental Symbols and Pictographs
+    {0x20000, 0x2fffd},  // CJK
+    {0x30000, 0x3fffd},
+}};
+
+/**
+ * Two-stage lookup table for the width of a code point with
+ * `text_width_algorithm::fmt_v10`, built from `fmt_v10_wide_ranges`.
+ *
+ * Code points are split into blocks of 256. The first stage maps every
+ * block to a 256-bit bitmap in the second stage, with a bit set for every
+ * code point with a width of 2. Blocks 0 (all narrow) and 1 (all wide) are
+ * shared, so that only the few blocks with both need one of their own.
+ */
+struct fmt_v10_width_table {
+    static constexpr char32_t block_size = 256;
+    /// Every code point from here on has a width of 1
+    static constexpr char32_t end = 0x40000;
+    /// Shared all-narrow and all-wide blocks, and the mixed ones
+    static constexpr std::size_t block_count = 2 + 11;
+
+    std::array<uint8_t, end / block_size> stage1{};
+    std::array<std::array<uint8_t, block_size / 8>, block_count> stage2{};
+};
+
+constexpr fmt_v10_width_table make_fmt_v10_width_table()
+{
+    constexpr uint32_t block_size = fmt_v10_width_table::block_size;
+
+    fmt_v10_width_table table{};
+    for (auto& bits : table.stage2[1]) {
+        bits = 0xff;
+    }
+
+    uint8_t next_block = 2;
+    for (const auto& range : fmt_v10_wide_ranges) {
+        uint32_t cp = range.first;
+        while (cp <= range.last) {
+            const uint32_t block = cp / block_size;
+            const uint32_t block_first = block * block_size;
+            const uint32_t block_last = block_first + block_size - 1;
+            const uint32_t last =
+                (std::min)(static_cast<uint32_t>(range.last), block_last);
+
+            if (cp == block_first && last == block_last) {
+                table.stage1[block] = 1;
+            }
+            else {
+                if (table.stage1[block] == 0) {
+                    table.stage1[block] = next_block++;
+                }
+                auto& bits = table.stage2[table.stage1[block]];
+                for (auto i = cp - block_first; i <= last - block_first; ++i) {
+                    bits[i / 8] = static_cast<uint8_t>(bits[i / 8] |
+                                                       (1u << (i % 8)));
+                }
+            }
+            cp = last + 1;
+        }
+    }
+    return table;
+}
+
+inline constexpr auto fmt_v10_width_lookup = make_fmt_v10_width_table();
+
 constexpr std::size_t calculate_text_width_for_fmt_v10(char32_t cp)
 {
-    if (cp >= 0x1100 &&
-        (cp <= 0x115f ||  // Hangul Jamo init. consonants
-         cp == 0x2329 ||  // LEFT-POINTING ANGLE BRACKET
-         cp == 0x232a ||  // RIGHT-POINTING ANGLE BRACKET
-         // CJK ... Yi except IDEOGRAPHIC HALF FILL SPACE:
-         (cp >= 0x2e80 && cp <= 0xa4cf && cp != 0x303f) ||
-         (cp >= 0xac00 && cp <= 0xd7a3) ||    // Hangul Syllables
-         (cp >= 0xf900 && cp <= 0xfaff) ||    // CJK Compatibility Ideographs
-         (cp >= 0xfe10 && cp <= 0xfe19) ||    // Vertical Forms
-         (cp >= 0xfe30 && cp <= 0xfe6f) ||    // CJK Compatibility Forms
-         (cp >= 0xff00 && cp <= 0xff60) ||    // Fullwidth Forms
-         (cp >= 0xffe0 && cp <= 0xffe6) ||    // Fullwidth Forms
-         (cp >= 0x20000 && cp <= 0x2fffd) ||  // CJK
-         (cp >= 0x30000 && cp <= 0x3fffd) ||
-         // Miscellaneous Symbols and Pictographs + Emoticons:
-         (cp >= 0x1f300 && cp <= 0x1f64f) ||
-         // Supplemental Symbols and Pictographs:
-         (cp >= 0x1f900 && cp <= 0x1f9ff))) {
-        return 2;
+    if (cp < fmt_v10_wide_ranges.front().first ||
+        cp >= fmt_v10_width_table::end) {
+        return 1;
+    }
+
+    constexpr auto block_size = fmt_v10_width_table::block_size;
+    const auto block = fmt_v10_width_lookup.stage1[cp / block_size];
+    const auto offset = cp % block_size;
+    return 1 + ((fmt_v10_width_lookup.stage2[block][offset / 8] >>
+                 (offset % 8)) &
+                1u);
+}
+
+/// Position of the first non-ASCII code unit in `input`
+template <typename CharT>
+auto find_nonascii(std::basic_string_view<CharT> input) ->
+    typename std::basic_string_view<CharT>::iterator
+{
+    if constexpr (std::is_same_v<CharT, char>) {
+        return find_nonascii_narrow_fast(input);
+    }
+    else {
+        return std::find_if(input.begin(), input.end(),
+                            [](CharT ch) { return !is_ascii_char(ch); });
+    }
+}
+
+/**
+ * Width of `input` with `text_width_algorithm::fmt_v10`.
+ *
+ * Every ASCII code point has a width of 1, so runs of ASCII are skipped
+ * over with a vectorized search, and only the code points in between them
+ * are decoded and looked up.
+ * Gives the same result as summing up the widths of the code points given by
+ * `get_next_code_point` (or `get_next_code_point_valid`, if `IsValid`).
+ */
+template <bool IsValid, typename CharT>
+std::size_t calculate_text_width_for_fmt_v10(
+    std::basic_string_view<CharT> input)
+{
+    std::size_t count{0};
+    auto it = input.begin();
+    while (it != input.end()) {
+        const auto ascii_end = detail::make_string_view_iterator(
+            input, find_nonascii(detail::make_string_view_from_iterators<CharT>(
+                       it, input.end())));
+        count += static_cast<std::size_t>(ascii_end - it);
+        it = ascii_end;
+
+        while (it != input.end() && !is_ascii_char(*it)) {
+            const auto rest =
+                detail::make_string_view_from_iterators<CharT>(it, input.end());
+            const auto res = [&]() {
+                if constexpr (IsValid) {
+                    return get_next_code_point_valid(rest);
+                }
+                else {
+                    return get_next_code_point(rest);
+                }
+            }();
+            count += calculate_text_width_for_fmt_v10(res.value);
+            it = detail::make_string_view_iterator(input, res.iterator);
+        }
     }
-    return 1;
+    return count;
 }
 
 template <typename Dependent = void>
@@ -184,11 +318,7 @@ std::size_t calculate_valid_text_width(
         }
 
         case text_width_algorithm::fmt_v10: {
-            size_t count{0};
-            for_each_code_point_valid(input, [&count](char32_t cp) {
-                count += calculate_text_width_for_fmt_v10(cp);
-            });
-            return count;
+            return calculate_text_width_for_fmt_v10<true>(input);
         }
 
         default:
@@ -265,7 +395,12 @@ std::size_t calculate_text_width(
             set_clocale_classic_guard clocale_guard{LC_CTYPE};
 
             std::wstring winput;
-            transcode_to_string(input, winput);
+            if constexpr (std::is_same_v<CharT, wchar_t>) {
+                winput.assign(input.begin(), input.end());
+            }
+            else {
+                transcode_to_string(input, winput);
+            }
             const auto n = ::wcswidth(winput.data(), winput.size());
             SCN_ENSURE(n != -1);
             return static_cast<size_t>(n);
@@ -284,11 +419,7 @@ std::size_t calculate_text_width(
         }
 
         case text_width_algorithm::fmt_v10: {
-            size_t count{0};
-            for_each_code_point(input, [&count](char32_t cp) {
-                count += calculate_text_width_for_fmt_v10(cp);
-            });
-            return count;
+            return calculate_text_width_for_fmt_v10<false>(input);
         }
 
         default:
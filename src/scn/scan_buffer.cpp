@@ -21,6 +21,10 @@
 
 #include <cstdio>
 
+#if !SCN_DISABLE_IOSTREAM
+#include <istream>
+#endif
+
 namespace scn {
 SCN_BEGIN_NAMESPACE
 
@@ -347,6 +351,108 @@ void scan_file_buffer::sync(std::ptrdiff_t position)
         file_wrapper::unget(m_file, ch);
     }
 }
+
+#if !SCN_DISABLE_IOSTREAM
+namespace {
+// Access to the protected get area of any std::streambuf,
+// through pointers to members named through a derived class
+struct streambuf_get_area : std::streambuf {
+    static std::string_view get(const std::streambuf& sb)
+    {
+        const auto begin = (sb.*&streambuf_get_area::gptr)();
+        const auto end = (sb.*&streambuf_get_area::egptr)();
+        if (begin == nullptr || begin == end) {
+            return {};
+        }
+        return make_string_view_from_pointers(begin, end);
+    }
+
+    static void bump(std::streambuf& sb, std::ptrdiff_t n)
+    {
+        SCN_EXPECT(n <= static_cast<std::ptrdiff_t>(get(sb).size()));
+        (sb.*&streambuf_get_area::gbump)(static_cast<int>(n));
+    }
+};
+}  // namespace
+
+scan_istream_buffer::scan_istream_buffer(const std::istream& stream)
+    : base(base::non_contiguous_tag{}), m_streambuf(stream.rdbuf())
+{
+    // Like the sentry of operator>>
+    if (auto tied = stream.tie()) {
+        tied->flush();
+    }
+}
+
+void scan_istream_buffer::consume_from_streambuf(std::ptrdiff_t n)
+{
+    if (n == 0) {
+        return;
+    }
+    if (this->m_current_view.data() == &m_latest) {
+        SCN_EXPECT(n == 1);
+        m_streambuf->sbumpc();
+        return;
+    }
+    streambuf_get_area::bump(*m_streambuf, n);
+}
+
+bool scan_istream_buffer::fill()
+{
+    if (!m_streambuf) {
+        return false;
+    }
+
+    if (!this->m_current_view.empty()) {
+        this->m_putback_buffer.insert(this->m_putback_buffer.end(),
+                                      this->m_current_view.begin(),
+                                      this->m_current_view.end());
+        consume_from_streambuf(
+            static_cast<std::ptrdiff_t>(this->m_current_view.size()));
+    }
+
+    const auto next = m_streambuf->sgetc();
+    if (std::char_traits<char>::eq_int_type(next,
+                                            std::char_traits<char>::eof())) {
+        this->m_current_view = {};
+        return false;
+    }
+
+    this->m_current_view = streambuf_get_area::get(*m_streambuf);
+    if (this->m_current_view.empty()) {
+        // Unbuffered streambuf, e.g. std::cin synchronized with stdio
+        m_latest = std::char_traits<char>::to_char_type(next);
+        this->m_current_view = {&m_latest, 1};
+    }
+    return true;
+}
+
+void scan_istream_buffer::sync(std::ptrdiff_t position)
+{
+    if (!m_streambuf) {
+        return;
+    }
+
+    const auto putback_size =
+        static_cast<std::ptrdiff_t>(this->putback_buffer().size());
+    if (position >= putback_size) {
+        consume_from_streambuf(position - putback_size);
+        return;
+    }
+
+    // The characters in the putback buffer have already been consumed from
+    // the streambuf: best effort, this only succeeds if they're still
+    // in its get area
+    auto putback_segment =
+        std::string_view{this->putback_buffer()}.substr(position);
+    for (auto ch : ranges::views::reverse(putback_segment)) {
+        if (std::char_traits<char>::eq_int_type(
+                m_streambuf->sputbackc(ch), std::char_traits<char>::eof())) {
+            break;
+        }
+    }
+}
+#endif
 }  // namespace detail
 
 SCN_END_NAMESPACE
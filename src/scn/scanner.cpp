@@ -15,8 +15,12 @@
 // This file is a part of scnlib:
 //     https://github.com/eliaskosunen/scnlib
 
+#include <scn/detail/fixed_decimal.h>
+#include <scn/detail/scanner_range.h>
 #include <scn/detail/xchar.h>
 #include <scn/impl/reader/common.h>
+#include <scn/impl/reader/fixed_decimal_reader.h>
+#include <scn/impl/reader/range_reader.h>
 #include <scn/impl/reader/reader.h>
 
 namespace scn {
@@ -45,6 +49,45 @@ scan_expected<ranges::iterator_t<Range>> internal_skip_classic_whitespace(
         .transform_error(impl::make_eof_scan_error);
 }
 
+template <typename Context>
+scan_expected<typename Context::iterator> scan_fixed_decimal_magnitude(
+    Context& ctx,
+    unsigned scale,
+    fixed_decimal_rounding rounding,
+    std::uint64_t& magnitude,
+    bool& is_negative)
+{
+    return impl::read_fixed_decimal_magnitude(ctx.range(), scale, rounding,
+                                              magnitude, is_negative);
+}
+
+template <typename Context>
+std::size_t estimate_range_element_count(
+    Context& ctx,
+    std::basic_string_view<typename Context::char_type> separator,
+    std::basic_string_view<typename Context::char_type> closing_bracket)
+{
+    const auto input = impl::get_contiguous_beginning(ctx.range());
+    return impl::estimate_range_element_count(
+        std::basic_string_view<typename Context::char_type>{
+            input.data(), ranges_polyfill::usize(input)},
+        separator, closing_bracket);
+}
+
+template <typename T, typename Context>
+scan_expected<typename Context::iterator> scan_range_elements(
+    Context& ctx,
+    std::basic_string_view<typename Context::char_type> separator,
+    std::basic_string_view<typename Context::char_type> closing_bracket,
+    bool is_first,
+    T* elements,
+    std::size_t max_count,
+    std::size_t& count)
+{
+    return impl::read_range_elements(ctx.range(), separator, closing_bracket,
+                                     is_first, elements, max_count, count);
+}
+
 #define SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(T, Context)                         \
     template scan_expected<Context::iterator> scanner_scan_for_builtin_type( \
         T&, Context&, const format_specs&);
@@ -71,10 +114,29 @@ scan_expected<ranges::iterator_t<Range>> internal_skip_classic_whitespace(
     SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(regex_matches, Context)        \
     SCN_DEFINE_SCANNER_SCAN_FOR_TYPE(wregex_matches, Context)       \
     template scan_expected<ranges::iterator_t<Context::range_type>> \
-    internal_skip_classic_whitespace(Context::range_type, bool);
+    internal_skip_classic_whitespace(Context::range_type, bool);    \
+    template scan_expected<Context::iterator>                       \
+    scan_fixed_decimal_magnitude(Context&, unsigned,                \
+                                 fixed_decimal_rounding,            \
+                                 std::uint64_t&, bool&);            \
+    template std::size_t estimate_range_element_count(              \
+        Context&, std::basic_string_view<Context::char_type>,       \
+        std::basic_string_view<Context::char_type>);
+
+#define SCN_DEFINE_SCAN_RANGE_ELEMENTS_FOR_TYPE(T, Context)        \
+    template scan_expected<Context::iterator> scan_range_elements( \
+        Context&, std::basic_string_view<Context::char_type>,      \
+        std::basic_string_view<Context::char_type>, bool, T*,      \
+        std::size_t, std::size_t&);
 
 SCN_DEFINE_SCANNER_SCAN_FOR_CTX(scan_context)
 SCN_DEFINE_SCANNER_SCAN_FOR_CTX(wscan_context)
+SCN_DEFINE_SCANNER_SCAN_FOR_CTX(contiguous_scan_context)
+SCN_DEFINE_SCANNER_SCAN_FOR_CTX(wcontiguous_scan_context)
+SCN_FOR_EACH_BULK_RANGE_ELEMENT_TYPE(SCN_DEFINE_SCAN_RANGE_ELEMENTS_FOR_TYPE,
+                                     scan_context)
+SCN_FOR_EACH_BULK_RANGE_ELEMENT_TYPE(SCN_DEFINE_SCAN_RANGE_ELEMENTS_FOR_TYPE,
+                                     wscan_context)
 }  // namespace detail
 
 SCN_END_NAMESPACE
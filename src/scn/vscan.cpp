@@ -23,7 +23,6 @@
 #include <scn/detail/xchar.h>
 #include <scn/impl/reader/integer_reader.h>
 #include <scn/impl/reader/reader.h>
-#include <scn/impl/util/contiguous_context.h>
 
 namespace scn {
 SCN_BEGIN_NAMESPACE
@@ -52,13 +51,29 @@ scan_expected<std::ptrdiff_t> scan_simple_single_argument(
     }
 
     auto reader =
-        impl::default_arg_reader<impl::basic_contiguous_scan_context<CharT>>{
+        impl::default_arg_reader<basic_contiguous_scan_context<CharT>>{
             ranges::subrange<const CharT*>{source.data(),
                                            source.data() + source.size()},
             SCN_MOVE(args), loc};
     SCN_TRY(it, visit_scan_arg(SCN_MOVE(reader), arg));
     return ranges::distance(source.data(), it);
 }
+/**
+ * `true`, if `buffer` has been marked as ASCII with `scn::ascii_source`,
+ * and it can be checked to be so while scanning.
+ * Only contiguous narrow buffers can be checked.
+ */
+template <typename CharT>
+bool is_checkable_ascii_buffer(const detail::basic_scan_buffer<CharT>& buffer)
+{
+    if constexpr (std::is_same_v<CharT, char>) {
+        return buffer.is_marked_ascii() && buffer.is_contiguous();
+    }
+    else {
+        return false;
+    }
+}
+
 template <typename CharT>
 scan_expected<std::ptrdiff_t> scan_simple_single_argument(
     detail::basic_scan_buffer<CharT>& source,
@@ -71,16 +86,26 @@ scan_expected<std::ptrdiff_t> scan_simple_single_argument(
                                      "Argument #0 not found");
     }
 
+    // Only a single value is read, so there's nothing to gain from caching
+    auto validation_cache =
+        source.assumes_valid_encoding()
+            ? impl::encoding_validation_cache<CharT>::assume_valid()
+            : impl::encoding_validation_cache<CharT>{};
+    if (is_checkable_ascii_buffer(source)) {
+        validation_cache = impl::encoding_validation_cache<CharT>::ascii_hinted(
+            source.current_view(), source.assumes_valid_encoding());
+    }
+
     if (SCN_LIKELY(source.is_contiguous())) {
         auto reader = impl::default_arg_reader<
-            impl::basic_contiguous_scan_context<CharT>>{source.get_contiguous(),
-                                                        SCN_MOVE(args), loc};
+            basic_contiguous_scan_context<CharT>>{
+            source.get_contiguous(), SCN_MOVE(args), loc, &validation_cache};
         SCN_TRY(it, visit_scan_arg(SCN_MOVE(reader), arg));
         return ranges::distance(source.get_contiguous().begin(), it);
     }
 
     auto reader = impl::default_arg_reader<basic_scan_context<CharT>>{
-        source.get(), SCN_MOVE(args), loc};
+        source.get(), SCN_MOVE(args), loc, &validation_cache};
     SCN_TRY(it, visit_scan_arg(SCN_MOVE(reader), arg));
     return it.position();
 }
@@ -244,17 +269,13 @@ struct simple_context_wrapper {
     {
         return ctx;
     }
-    basic_scan_context<CharT>& get_custom()
-    {
-        return ctx;
-    }
 
     basic_scan_context<CharT> ctx;
 };
 
 template <typename CharT>
 struct contiguous_context_wrapper {
-    using context_type = impl::basic_contiguous_scan_context<CharT>;
+    using context_type = basic_contiguous_scan_context<CharT>;
 
     contiguous_context_wrapper(ranges::subrange<const CharT*> source,
                                basic_scan_args<basic_scan_context<CharT>> args,
@@ -263,27 +284,12 @@ struct contiguous_context_wrapper {
     {
     }
 
-    impl::basic_contiguous_scan_context<CharT>& get()
+    basic_contiguous_scan_context<CharT>& get()
     {
         return contiguous_ctx;
     }
-    basic_scan_context<CharT>& get_custom()
-    {
-        if (!buffer) {
-            buffer.emplace(detail::make_string_view_from_pointers(
-                ranges::data(contiguous_ctx.underlying_range()),
-                ranges::data(contiguous_ctx.underlying_range()) +
-                    ranges::size(contiguous_ctx.underlying_range())));
-        }
-        auto it = buffer->get().begin();
-        it.batch_advance_to(contiguous_ctx.begin_position());
-        custom_ctx.emplace(it, contiguous_ctx.args(), contiguous_ctx.locale());
-        return *custom_ctx;
-    }
 
-    impl::basic_contiguous_scan_context<CharT> contiguous_ctx;
-    std::optional<detail::basic_scan_string_buffer<CharT>> buffer{std::nullopt};
-    std::optional<basic_scan_context<CharT>> custom_ctx{std::nullopt};
+    basic_contiguous_scan_context<CharT> contiguous_ctx;
 };
 
 template <bool Contiguous, typename CharT>
@@ -377,7 +383,8 @@ struct format_handler : format_handler_base {
 
         on_visit_scan_arg(
             impl::default_arg_reader<context_type>{
-                get_ctx().range(), get_ctx().args(), get_ctx().locale()},
+                get_ctx().range(), get_ctx().args(), get_ctx().locale(),
+                &validation_cache, &transcode_scratch},
             arg);
     }
 
@@ -391,8 +398,7 @@ struct format_handler : format_handler_base {
         if (arg.type() == detail::arg_type::custom_type) {
             parse_ctx.advance_to(begin);
             on_visit_scan_arg(
-                impl::custom_reader<basic_scan_context<char_type>>{
-                    parse_ctx, get_custom_ctx()},
+                impl::custom_reader<context_type>{parse_ctx, get_ctx()},
                 arg);
             return parse_ctx.begin();
         }
@@ -413,9 +419,23 @@ struct format_handler : format_handler_base {
         }
         parse_ctx.advance_to(begin);
 
+        if (specs.type == detail::presentation_type::string_set &&
+            specs.charset_has_nonascii) {
+            if (auto e = impl::compile_nonascii_charset<char_type>(
+                    specs, charset_ranges);
+                SCN_UNLIKELY(!e)) {
+                on_error(e);
+                return parse_ctx.begin();
+            }
+            specs.charset_nonascii_ranges = charset_ranges.data();
+            specs.charset_nonascii_ranges_size = charset_ranges.size();
+        }
+
         on_visit_scan_arg(
             impl::arg_reader<context_type>{get_ctx().range(), specs,
-                                           get_ctx().locale()},
+                                           get_ctx().locale(),
+                                           &validation_cache,
+                                           &transcode_scratch},
             arg);
         return parse_ctx.begin();
     }
@@ -424,13 +444,16 @@ struct format_handler : format_handler_base {
     {
         return ctx.get();
     }
-    auto& get_custom_ctx()
-    {
-        return ctx.get_custom();
-    }
 
     parse_context_type parse_ctx;
     context_wrapper_type ctx;
+    impl::encoding_validation_cache<char_type> validation_cache{};
+    // Shared by every string argument of a single scan call,
+    // for copying them out of non-contiguous sources before transcoding
+    std::basic_string<char_type> transcode_scratch{};
+    // Non-ASCII members of the character set of the current argument,
+    // compiled once when its format specs are parsed
+    std::vector<impl::charset_range> charset_ranges{};
 };
 
 template <typename CharT, typename Handler>
@@ -463,6 +486,7 @@ scan_expected<std::ptrdiff_t> vscan_internal(
         ranges::subrange<const CharT*>{source.data(),
                                        source.data() + source.size()},
         format, SCN_MOVE(args), SCN_MOVE(loc), argcount};
+    handler.validation_cache = impl::encoding_validation_cache<CharT>{source};
     return vscan_parse_format_string(format, handler);
 }
 
@@ -483,6 +507,19 @@ scan_expected<std::ptrdiff_t> vscan_internal(
         auto handler = format_handler<true, CharT>{buffer.get_contiguous(),
                                                    format, SCN_MOVE(args),
                                                    SCN_MOVE(loc), argcount};
+        if (is_checkable_ascii_buffer(buffer)) {
+            handler.validation_cache =
+                impl::encoding_validation_cache<CharT>::ascii_hinted(
+                    buffer.current_view(), buffer.assumes_valid_encoding());
+        }
+        else if (buffer.assumes_valid_encoding()) {
+            handler.validation_cache =
+                impl::encoding_validation_cache<CharT>::assume_valid();
+        }
+        else {
+            handler.validation_cache =
+                impl::encoding_validation_cache<CharT>{buffer.current_view()};
+        }
         return vscan_parse_format_string(format, handler);
     }
 
@@ -490,6 +527,10 @@ scan_expected<std::ptrdiff_t> vscan_internal(
     {
         auto handler = format_handler<false, CharT>{
             buffer, format, SCN_MOVE(args), SCN_MOVE(loc), argcount};
+        if (buffer.assumes_valid_encoding()) {
+            handler.validation_cache =
+                impl::encoding_validation_cache<CharT>::assume_valid();
+        }
         return vscan_parse_format_string(format, handler);
     }
 }
@@ -15,11 +15,13 @@
 // This file is a part of scnlib:
 //     https://github.com/eliaskosunen/scnlib
 
+#include <scn/regex.h>
 #include <scn/scan.h>
 
 int main()
 {
-    // build error: Cannot read a regex from a non-contiguous
-    auto result = scn::scan<std::string>(stdin, SCN_STRING("{:/[a-z]+/}"));
+    // build error: Cannot read a regex_matches from a non-contiguous
+    auto result =
+        scn::scan<scn::regex_matches>(stdin, SCN_STRING("{:/([a-z]+)/}"));
     return !result.has_value();
 }
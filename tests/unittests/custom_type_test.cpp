@@ -19,6 +19,8 @@
 
 #include <scn/detail/scan.h>
 
+#include <deque>
+
 struct mytype {
     int i{}, j{};
 };
@@ -110,3 +112,83 @@ TEST(CustomTypeTest, WhiteSpaceNotSkipped)
 
     EXPECT_EQ(result->value().ch, 'a');
 }
+
+struct mytype3 {
+    int i{}, j{};
+    bool scanned_contiguously{false};
+};
+
+template <>
+struct scn::scanner<mytype3, char> : scn::scanner<mytype, char> {
+    template <typename Context>
+    scn::scan_expected<typename Context::iterator> scan(mytype3& val,
+                                                        Context& ctx) const
+    {
+        val.scanned_contiguously =
+            std::is_same_v<Context, scn::contiguous_scan_context>;
+        return scn::scan<int, int>(ctx.range(), "{} {}")
+            .transform([&](auto result) {
+                std::tie(val.i, val.j) = result.values();
+                return result.begin();
+            });
+    }
+};
+
+template <>
+struct scn::scanner_supports_contiguous_context<mytype3, char>
+    : std::true_type {};
+
+TEST(CustomTypeTest, ContiguousContext)
+{
+    auto input = std::string_view{"1 2 3 4"};
+    auto result = scn::scan<mytype3, int>(input, "{} {}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->begin(), input.end() - 2);
+
+    const auto& [val, i] = result->values();
+    EXPECT_EQ(val.i, 1);
+    EXPECT_EQ(val.j, 2);
+    EXPECT_TRUE(val.scanned_contiguously);
+    EXPECT_EQ(i, 3);
+}
+
+TEST(CustomTypeTest, ContiguousContextDelegatingToBuiltinScanners)
+{
+    struct delegating {
+        int i{};
+        double d{};
+    };
+    auto val = delegating{};
+    auto ctx = scn::contiguous_scan_context{std::string_view{"1 2.5"}, {}};
+    auto r = scn::scanner<int>{}.scan(val.i, ctx).and_then([&](auto it) {
+        ctx.advance_to(it);
+        return scn::scanner<double>{}.scan(val.d, ctx);
+    });
+    ASSERT_TRUE(r);
+    EXPECT_EQ(*r, ctx.end());
+    EXPECT_EQ(val.i, 1);
+    EXPECT_DOUBLE_EQ(val.d, 2.5);
+}
+
+TEST(CustomTypeTest, NonContiguousContextWithContiguousSource)
+{
+    auto input = std::string_view{"1 2 3"};
+    auto result = scn::scan<mytype, int>(input, "{} {}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->begin(), input.end());
+
+    const auto& [val, i] = result->values();
+    EXPECT_EQ(val.i, 1);
+    EXPECT_EQ(val.j, 2);
+    EXPECT_EQ(i, 3);
+}
+
+TEST(CustomTypeTest, ContiguousContextWithNonContiguousSource)
+{
+    auto input = std::deque<char>{'1', ' ', '2'};
+    auto result = scn::scan<mytype3>(input, "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().i, 1);
+    EXPECT_EQ(result->value().j, 2);
+    EXPECT_FALSE(result->value().scanned_contiguously);
+}
@@ -0,0 +1,171 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "wrapped_gtest.h"
+
+#include <scn/fixed_decimal.h>
+#include <scn/scan.h>
+#include <scn/xchar.h>
+
+#include <cstdint>
+
+using price = scn::fixed_decimal<std::int64_t, 6>;
+
+TEST(FixedDecimalTest, Basic)
+{
+    auto result = scn::scan<price>("12345.678901", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().value, 12345678901);
+    EXPECT_TRUE(result->range().empty());
+}
+
+TEST(FixedDecimalTest, Negative)
+{
+    auto result = scn::scan<price>("-12345.678901", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().value, -12345678901);
+}
+
+TEST(FixedDecimalTest, FewerFractionalDigitsThanScale)
+{
+    auto result = scn::scan<price>("1.5", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().value, 1'500'000);
+}
+
+TEST(FixedDecimalTest, OnlyIntegerOrFraction)
+{
+    {
+        auto result = scn::scan<price>("42 ", "{}");
+        ASSERT_TRUE(result);
+        EXPECT_EQ(result->value().value, 42'000'000);
+        EXPECT_EQ(std::string_view(result->range().data(),
+                                   result->range().size()),
+                  " ");
+    }
+    {
+        auto result = scn::scan<price>("42.", "{}");
+        ASSERT_TRUE(result);
+        EXPECT_EQ(result->value().value, 42'000'000);
+        EXPECT_TRUE(result->range().empty());
+    }
+    {
+        auto result = scn::scan<price>(".25", "{}");
+        ASSERT_TRUE(result);
+        EXPECT_EQ(result->value().value, 250'000);
+    }
+}
+
+TEST(FixedDecimalTest, NoDigits)
+{
+    auto result = scn::scan<price>(".", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+
+    result = scn::scan<price>("-abc", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
+TEST(FixedDecimalTest, Rounding)
+{
+    using rounding = scn::fixed_decimal_rounding;
+    using truncating =
+        scn::fixed_decimal<std::int64_t, 2, rounding::toward_zero>;
+    using even = scn::fixed_decimal<std::int64_t, 2, rounding::to_nearest_even>;
+    using away = scn::fixed_decimal<std::int64_t, 2,
+                                    rounding::to_nearest_away_from_zero>;
+
+    auto a = scn::scan<truncating, truncating>("1.239 -1.239", "{} {}");
+    ASSERT_TRUE(a);
+    EXPECT_EQ(std::get<0>(a->values()).value, 123);
+    EXPECT_EQ(std::get<1>(a->values()).value, -123);
+
+    auto b = scn::scan<even, even, even, even>("1.225 1.235 1.2250001 -1.235",
+                                               "{} {} {} {}");
+    ASSERT_TRUE(b);
+    EXPECT_EQ(std::get<0>(b->values()).value, 122);
+    EXPECT_EQ(std::get<1>(b->values()).value, 124);
+    EXPECT_EQ(std::get<2>(b->values()).value, 123);
+    EXPECT_EQ(std::get<3>(b->values()).value, -124);
+
+    auto c = scn::scan<away, away, away>("1.225 -1.225 1.2249", "{} {} {}");
+    ASSERT_TRUE(c);
+    EXPECT_EQ(std::get<0>(c->values()).value, 123);
+    EXPECT_EQ(std::get<1>(c->values()).value, -123);
+    EXPECT_EQ(std::get<2>(c->values()).value, 122);
+}
+
+TEST(FixedDecimalTest, Limits)
+{
+    {
+        auto result = scn::scan<price>("9223372036854.775807", "{}");
+        ASSERT_TRUE(result);
+        EXPECT_EQ(result->value().value,
+                  std::numeric_limits<std::int64_t>::max());
+    }
+    {
+        auto result = scn::scan<price>("-9223372036854.775808", "{}");
+        ASSERT_TRUE(result);
+        EXPECT_EQ(result->value().value,
+                  std::numeric_limits<std::int64_t>::min());
+    }
+    {
+        auto result = scn::scan<price>("9223372036854.775808", "{}");
+        ASSERT_FALSE(result);
+        EXPECT_EQ(result.error().code(), scn::scan_error::value_out_of_range);
+    }
+    {
+        auto result = scn::scan<price>("100000000000000000000", "{}");
+        ASSERT_FALSE(result);
+        EXPECT_EQ(result.error().code(), scn::scan_error::value_out_of_range);
+    }
+    {
+        auto result =
+            scn::scan<scn::fixed_decimal<std::int32_t, 2>>("21474836.48", "{}");
+        ASSERT_FALSE(result);
+        EXPECT_EQ(result.error().code(), scn::scan_error::value_out_of_range);
+    }
+}
+
+TEST(FixedDecimalTest, Unsigned)
+{
+    using unsigned_price = scn::fixed_decimal<std::uint64_t, 3>;
+
+    auto result = scn::scan<unsigned_price>("18446744073709551.615", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().value,
+              std::numeric_limits<std::uint64_t>::max());
+
+    result = scn::scan<unsigned_price>("-1.5", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
+TEST(FixedDecimalTest, Wide)
+{
+    auto result = scn::scan<price>(L"  -0.000001", L"{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().value, -1);
+}
+
+TEST(FixedDecimalTest, InvalidFormatSpecifier)
+{
+    auto result = scn::scan<price>("1.5", scn::runtime_format("{:x}"));
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_format_string);
+}
@@ -59,6 +59,27 @@ TEST(BitsTest, CountTrailingZeroes)
               0);
 }
 
+TEST(BitsTest, CountLeadingZeroes)
+{
+    EXPECT_EQ(scn::impl::count_leading_zeroes(0b0001), 63);
+    EXPECT_EQ(scn::impl::count_leading_zeroes(0b1000), 60);
+    EXPECT_EQ(scn::impl::count_leading_zeroes(0b1111), 60);
+
+    EXPECT_EQ(
+        scn::impl::count_leading_zeroes(std::numeric_limits<uint64_t>::max()),
+        0);
+    EXPECT_EQ(scn::impl::count_leading_zeroes(
+                  std::numeric_limits<uint64_t>::max() >> 1),
+              1);
+    EXPECT_EQ(scn::impl::count_leading_zeroes(
+                  static_cast<uint64_t>(std::numeric_limits<uint32_t>::max())),
+              32);
+    EXPECT_EQ(scn::impl::count_leading_zeroes(
+                  static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) +
+                  1),
+              31);
+}
+
 TEST(BitsTest, HasZeroByte)
 {
     EXPECT_TRUE(scn::impl::has_zero_byte(0));
@@ -17,8 +17,11 @@
 
 #include "../wrapped_gtest.h"
 
+#include <scn/detail/scan_buffer.h>
 #include <scn/impl/algorithms/contiguous_range_factory.h>
 
+#include <deque>
+
 TEST(StringViewWrapperTest, DefaultConstructible)
 {
     scn::impl::string_view_wrapper<char> svw{};
@@ -123,3 +126,28 @@ TEST(MakeContiguousBufferTest, RvalueStringIntoContiguousRangeFactory)
                                  scn::impl::contiguous_range_factory<char>>);
     EXPECT_EQ(buf.view(), "ghi");
 }
+
+TEST(MakeContiguousViewWithScratchTest, ContiguousSourceIsNotCopied)
+{
+    std::string scratch{};
+    auto src = std::string_view{"abc"};
+    auto view = scn::impl::make_contiguous_view_with_scratch(src, scratch);
+    EXPECT_EQ(view.data(), src.data());
+    EXPECT_TRUE(scratch.empty());
+}
+TEST(MakeContiguousViewWithScratchTest, NonContiguousSourceReusesScratch)
+{
+    std::string scratch{};
+    scratch.reserve(64);
+    const auto* scratch_data = scratch.data();
+
+    auto first = std::deque<char>{'a', 'b', 'c'};
+    auto view = scn::impl::make_contiguous_view_with_scratch(first, scratch);
+    EXPECT_EQ(view, "abc");
+    EXPECT_EQ(view.data(), scratch_data);
+
+    auto second = std::deque<char>{'d', 'e'};
+    view = scn::impl::make_contiguous_view_with_scratch(second, scratch);
+    EXPECT_EQ(view, "de");
+    EXPECT_EQ(view.data(), scratch_data);
+}
@@ -157,3 +157,173 @@ TEST(FindClassicNonspaceNarrowFastTest, EmojiInput)
             scn::impl::find_classic_nonspace_narrow_fast(input.substr(4))),
         input.data() + 5);
 }
+
+TEST(FindClassicSpaceNarrowFastTest, MultibyteSpaces)
+{
+    for (auto space : {"\xc2\x85"sv, "\xe2\x80\x8e"sv, "\xe2\x80\x8f"sv,
+                       "\xe2\x80\xa8"sv, "\xe2\x80\xa9"sv}) {
+        // Place the space at every position across a 32-byte block boundary
+        for (std::size_t prefix_len = 0; prefix_len < 40; ++prefix_len) {
+            auto src = std::string(prefix_len, 'a');
+            src.append(space);
+            src.append("bbbb");
+            auto sv = std::string_view{src};
+
+            EXPECT_EQ(scn::detail::to_address(
+                          scn::impl::find_classic_space_narrow_fast(sv)),
+                      sv.data() + prefix_len);
+        }
+    }
+}
+TEST(FindClassicSpaceNarrowFastTest, NonSpaceLeadBytes)
+{
+    // U+00A0 NO-BREAK SPACE and U+202A, and truncated sequences,
+    // aren't Pattern_White_Space
+    auto src =
+        "\xc2\xa0\xe2\x80\xaa aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\xe2\x80"sv;
+    EXPECT_EQ(scn::detail::to_address(
+                  scn::impl::find_classic_space_narrow_fast(src)),
+              src.data() + 5);
+    EXPECT_EQ(scn::impl::find_classic_space_narrow_fast(src.substr(6)),
+              src.substr(6).end());
+}
+
+TEST(FindClassicNonspaceNarrowFastTest, MultibyteSpaces)
+{
+    for (std::size_t prefix_len = 0; prefix_len < 40; ++prefix_len) {
+        auto src = std::string(prefix_len, ' ');
+        src.append("\xe2\x80\xa8\xc2\x85\t\xe2\x80\x8f");
+        auto sv = std::string_view{src};
+        EXPECT_EQ(scn::impl::find_classic_nonspace_narrow_fast(sv), sv.end());
+
+        src.append("x");
+        sv = std::string_view{src};
+        EXPECT_EQ(scn::detail::to_address(
+                      scn::impl::find_classic_nonspace_narrow_fast(sv)),
+                  sv.data() + sv.size() - 1);
+    }
+}
+TEST(FindClassicNonspaceNarrowFastTest, NonSpaceLeadBytes)
+{
+    auto src = "                                \xe2\x80\xaa"sv;
+    EXPECT_EQ(scn::detail::to_address(
+                  scn::impl::find_classic_nonspace_narrow_fast(src)),
+              src.data() + 32);
+
+    src = "                                \xc2"sv;
+    EXPECT_EQ(scn::detail::to_address(
+                  scn::impl::find_classic_nonspace_narrow_fast(src)),
+              src.data() + 32);
+}
+
+namespace {
+    scn::impl::ascii_charset_bitmap make_ascii_charset(std::string_view chars)
+    {
+        scn::impl::ascii_charset_bitmap charset{};
+        for (auto ch : chars) {
+            const auto val = static_cast<unsigned char>(ch);
+            charset[val / 8] |= static_cast<uint8_t>(1u << (val % 8));
+        }
+        return charset;
+    }
+}  // namespace
+
+TEST(FindAsciiCharsetNarrowFastTest, Nonmember)
+{
+    const auto charset = make_ascii_charset("abc_09");
+    auto src = "abc_09cba0_9abc_09cba0_9abc_09cba0_9abc_09cba0_9 x"sv;
+    EXPECT_EQ(scn::impl::find_ascii_charset_nonmember_narrow_fast(src, charset),
+              src.end() - 2);
+    EXPECT_EQ(scn::impl::find_ascii_charset_nonmember_narrow_fast(
+                  src.substr(0, 20), charset),
+              src.begin() + 20);
+}
+TEST(FindAsciiCharsetNarrowFastTest, NonAsciiIsNeverMember)
+{
+    const auto charset = make_ascii_charset("abc");
+    auto src = "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\xc3\xa4"sv;
+    EXPECT_EQ(scn::impl::find_ascii_charset_nonmember_narrow_fast(src, charset),
+              src.begin() + 40);
+    EXPECT_EQ(scn::impl::find_ascii_charset_member_narrow_fast(
+                  src.substr(40), charset),
+              src.end());
+}
+TEST(FindAsciiCharsetNarrowFastTest, Member)
+{
+    const auto charset = make_ascii_charset("\x7f;");
+    auto src = "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx;\x7f"sv;
+    EXPECT_EQ(scn::impl::find_ascii_charset_member_narrow_fast(src, charset),
+              src.end() - 2);
+}
+
+TEST(FindNonasciiNarrowFastTest, AllAscii)
+{
+    auto src = "The quick brown fox jumps over the lazy dog"sv;
+    EXPECT_EQ(scn::impl::find_nonascii_narrow_fast(src), src.end());
+}
+TEST(FindNonasciiNarrowFastTest, NonasciiAtEveryPosition)
+{
+    for (std::size_t i = 0; i < 70; ++i) {
+        auto str = std::string(70, 'a');
+        str[i] = '\xc3';
+        auto src = std::string_view{str};
+        EXPECT_EQ(scn::impl::find_nonascii_narrow_fast(src), src.begin() + i)
+            << i;
+    }
+}
+
+TEST(FindClassicSpaceWideFastTest, SpacesAtEveryPosition)
+{
+    for (auto space : {L'\t', L'\r', L' ', L'\u0085', L'\u200e', L'\u200f',
+                       L'\u2028', L'\u2029'}) {
+        for (std::size_t i = 0; i < 24; ++i) {
+            auto str = std::wstring(24, L'a');
+            str[i] = space;
+            auto src = std::wstring_view{str};
+            EXPECT_EQ(scn::impl::find_classic_space_wide_fast(src),
+                      src.begin() + i)
+                << i;
+        }
+    }
+}
+TEST(FindClassicSpaceWideFastTest, NearMisses)
+{
+    // U+00A0, U+2000, U+2027, U+202A, U+200D, U+0108 and U+0020 + 0x10000
+    // aren't Pattern_White_Space
+    auto src = std::wstring{L"\u00a0\u2000\u2027\u202a\u200d\u0108a\x08"};
+    if constexpr (sizeof(wchar_t) == 4) {
+        src.push_back(static_cast<wchar_t>(0x10020));
+    }
+    auto sv = std::wstring_view{src};
+    EXPECT_EQ(scn::impl::find_classic_space_wide_fast(sv), sv.end());
+}
+
+TEST(FindClassicNonspaceWideFastTest, NonspaceAtEveryPosition)
+{
+    for (std::size_t i = 0; i < 24; ++i) {
+        auto str = std::wstring(24, L' ');
+        str[i] = L'x';
+        auto src = std::wstring_view{str};
+        EXPECT_EQ(scn::impl::find_classic_nonspace_wide_fast(src),
+                  src.begin() + i)
+            << i;
+    }
+    auto src = L" \t\n\u0085\u200e\u2028\u2029\v\f\r"sv;
+    EXPECT_EQ(scn::impl::find_classic_nonspace_wide_fast(src), src.end());
+}
+
+TEST(FindNondecimalDigitWideFastTest, NondigitAtEveryPosition)
+{
+    for (auto nondigit : {L'/', L':', L'\u0660', L'\uff10', L'a'}) {
+        for (std::size_t i = 0; i < 24; ++i) {
+            auto str = std::wstring(24, L'7');
+            str[i] = nondigit;
+            auto src = std::wstring_view{str};
+            EXPECT_EQ(scn::impl::find_nondecimal_digit_wide_fast(src),
+                      src.begin() + i)
+                << i;
+        }
+    }
+    auto src = L"0123456789"sv;
+    EXPECT_EQ(scn::impl::find_nondecimal_digit_wide_fast(src), src.end());
+}
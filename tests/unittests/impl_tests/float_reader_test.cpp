@@ -936,7 +936,7 @@ TYPED_TEST(FloatValueReaderTest, PresentationFixedValueHexWithoutPrefix)
 }
 
 template <typename T>
-T get_hexfloat_interpreted_as_decimal(const std::string& input)
+T parse_with_strtod(const std::string& input)
 {
     if constexpr (std::is_same_v<T, float>) {
         return std::strtof(input.c_str(), nullptr);
@@ -957,7 +957,7 @@ TYPED_TEST(FloatValueReaderTest, PresentationHexValueScientific)
     ASSERT_TRUE(result);
     EXPECT_TRUE(check_floating_eq(
         val,
-        get_hexfloat_interpreted_as_decimal<typename TestFixture::float_type>(
+        parse_with_strtod<typename TestFixture::float_type>(
             "0x12.3e4")));
     EXPECT_EQ(scn::detail::to_address(*result),
               this->widened_source->data() + this->widened_source->size());
@@ -970,7 +970,7 @@ TYPED_TEST(FloatValueReaderTest, PresentationHexValueFixed)
     ASSERT_TRUE(result);
     EXPECT_TRUE(check_floating_eq(
         val,
-        get_hexfloat_interpreted_as_decimal<typename TestFixture::float_type>(
+        parse_with_strtod<typename TestFixture::float_type>(
             "0x12.3")));
     EXPECT_EQ(scn::detail::to_address(*result),
               this->widened_source->data() + this->widened_source->size());
@@ -994,6 +994,85 @@ TYPED_TEST(FloatValueReaderTest, PresentationHexValueHexWithoutPrefix)
         val, static_cast<typename TestFixture::float_type>(0x1.fp3)));
 }
 
+TYPED_TEST(FloatValueReaderTest, DecimalRoundingMatchesStrtod)
+{
+    for (std::string_view src : {
+             "0.1",
+             "123456789012345678",
+             "1234567890123456789",
+             "12345678901234567890",
+             "18446744073709551615",
+             "18446744073709551617",
+             "9007199254740993",
+             "1.00000000000000011102230246251565404236316680908203125",
+             "0.000000000000000000000000000001",
+             "3.141592653589793238462643383279502884197",
+             "1e27",
+             "1e28",
+             "123456789e-27",
+             "123456789e-28",
+             "6.02214076e23",
+             "0.000123456789012345678901234567890",
+             // 64 characters or more, not null-terminated on the stack
+             "1.00000000000000000000000000000000000000000000000000000000000"
+             "000000001",
+             "1e00000000000000000000000000000000000000000000000000000000000"
+             "000000005",
+         }) {
+        auto [a, _, val] = this->simple_success_test(src);
+        EXPECT_TRUE(a) << src;
+        EXPECT_TRUE(check_floating_eq(
+            val, parse_with_strtod<
+                     typename TestFixture::float_type>(std::string{src})))
+            << src;
+    }
+}
+
+TYPED_TEST(FloatValueReaderTest, HexRoundingMatchesStrtod)
+{
+    for (std::string_view src : {
+             "0x1.000001p0",
+             "0x1.000003p0",
+             "0x1.0000010000000000001p0",
+             "0x1.00000000000008p0",
+             "0x1.00000000000018p0",
+             "0x1.00000000000008000000000001p0",
+             "0x1.0000000000000001p0",
+             "0x1.0000000000000003p0",
+             "0x1.fffffffffffffffffffffp0",
+             "0x123456789abcdef0123456789p-3",
+             "0x.8p1",
+             "0x0.00000000012345p-10",
+         }) {
+        auto [a, _, val] = this->simple_success_test(src);
+        EXPECT_TRUE(a) << src;
+        EXPECT_TRUE(check_floating_eq(
+            val, parse_with_strtod<
+                     typename TestFixture::float_type>(std::string{src})))
+            << src;
+    }
+}
+
+TYPED_TEST(FloatValueReaderTest, HexWithoutExponentDigits)
+{
+    auto [result, val] = this->simple_test("0x1.8p");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(scn::detail::to_address(result.value()),
+              this->widened_source->data() + 5);
+    EXPECT_TRUE(check_floating_eq(
+        val, static_cast<typename TestFixture::float_type>(1.5)));
+}
+
+TYPED_TEST(FloatValueReaderTest, PresentationHexValueStartingWithLetter)
+{
+    auto [a, _, val] = this->simple_success_specs_test(
+        "a.8p1", this->make_format_specs_with_presentation(
+                     scn::detail::presentation_type::float_hex));
+    EXPECT_TRUE(a);
+    EXPECT_TRUE(check_floating_eq(
+        val, static_cast<typename TestFixture::float_type>(21.0)));
+}
+
 #if !SCN_DISABLE_LOCALE
 template <typename CharT>
 struct numpunct_with_comma_thsep : std::numpunct<CharT> {
@@ -1042,6 +1121,22 @@ TYPED_TEST(FloatValueReaderTest, ThousandsSeparators)
     EXPECT_TRUE(check_floating_eq(val, this->get_thsep_number()));
 }
 
+TYPED_TEST(FloatValueReaderTest, ThousandsSeparatorsWithLongValue)
+{
+    if constexpr (!TestFixture::is_localized) {
+        return SUCCEED() << "This test requires a localized reader";
+    }
+
+    auto state = thsep_test_state<typename TestFixture::char_type>{"\3"};
+
+    auto [a, _, val] = this->simple_success_specs_and_locale_test(
+        "123,456.78900000000000000000000000000000000000000000000000000000000000"
+        "000000001",
+        state.specs, state.locref);
+    EXPECT_TRUE(a);
+    EXPECT_TRUE(check_floating_eq(val, this->get_thsep_number()));
+}
+
 TYPED_TEST(FloatValueReaderTest, ThousandsSeparatorsWithInvalidGrouping)
 {
     if constexpr (!TestFixture::is_localized) {
@@ -1121,3 +1216,23 @@ TYPED_TEST(FloatValueReaderTest, LocalizedDecimalSeparator)
     EXPECT_TRUE(check_floating_eq(val, this->get_pi().first));
 }
 #endif  // !SCN_DISABLE_LOCALE
+
+TEST(FloatReaderTest, ThousandsSeparatorsAfterMovingReader)
+{
+    auto make_reader = [](std::string_view source) {
+        auto rd = scn::impl::float_reader<char>{
+            scn::impl::float_reader_base::allow_fixed |
+            scn::impl::float_reader_base::allow_thsep};
+        auto it = rd.read_source(source, {});
+        EXPECT_TRUE(it);
+        EXPECT_EQ(*it, source.end());
+        return rd;
+    };
+
+    auto rd = make_reader("123,456.789");
+    double val{};
+    auto n = rd.parse_value(val);
+    ASSERT_TRUE(n);
+    EXPECT_EQ(*n, 11);
+    EXPECT_DOUBLE_EQ(val, 123456.789);
+}
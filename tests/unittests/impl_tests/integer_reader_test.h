@@ -870,6 +870,48 @@ TYPED_TEST_P(IntValueReaderTest, ExoticThousandsSeparatorsWithInvalidGrouping)
     EXPECT_TRUE(this->check_failure_with_code(
         result, val, scn::scan_error::invalid_scanned_value));
 }
+
+TYPED_TEST_P(IntValueReaderTest, ThousandsSeparatorsWithOverflow)
+{
+    if constexpr (!TestFixture::is_localized) {
+        return SUCCEED() << "This test requires a localized reader";
+    }
+
+    auto state = thsep_test_state<typename TestFixture::char_type>{"\3"};
+
+    auto [result, val] = this->simple_specs_and_locale_test(
+        "123,456,789,012,345,678,901,234", state.specs, state.locref);
+    EXPECT_TRUE(this->check_failure_with_code(
+        result, val, scn::scan_error::value_out_of_range));
+}
+
+TYPED_TEST_P(IntValueReaderTest, ThousandsSeparatorsWithManyGroups)
+{
+    if constexpr (!TestFixture::is_localized) {
+        return SUCCEED() << "This test requires a localized reader";
+    }
+
+    auto state = thsep_test_state<typename TestFixture::char_type>{"\1"};
+
+    // More groups than are tracked at once:
+    // valid grouping, but too large a value
+    {
+        auto [result, val] = this->simple_specs_and_locale_test(
+            "1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,"
+            "0,0,0,0,0,0,0,0,0,0,1",
+            state.specs, state.locref);
+        EXPECT_TRUE(this->check_failure_with_code(
+            result, val, scn::scan_error::value_out_of_range));
+    }
+    {
+        auto [result, val] = this->simple_specs_and_locale_test(
+            "1,0,0,0,0,0,0,0,0,00,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,"
+            "0,0,0,0,0,0,0,0,0,0,0,1",
+            state.specs, state.locref);
+        EXPECT_TRUE(this->check_failure_with_code(
+            result, val, scn::scan_error::invalid_scanned_value));
+    }
+}
 #endif
 
 REGISTER_TYPED_TEST_SUITE_P(IntValueReaderTest,
@@ -907,4 +949,6 @@ REGISTER_TYPED_TEST_SUITE_P(IntValueReaderTest,
                             ThousandsSeparators,
                             ThousandsSeparatorsWithInvalidGrouping,
                             ExoticThousandsSeparators,
-                            ExoticThousandsSeparatorsWithInvalidGrouping);
+                            ExoticThousandsSeparatorsWithInvalidGrouping,
+                            ThousandsSeparatorsWithOverflow,
+                            ThousandsSeparatorsWithManyGroups);
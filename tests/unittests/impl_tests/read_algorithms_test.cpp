@@ -19,6 +19,8 @@
 
 #include <scn/impl/algorithms/read.h>
 
+#include <deque>
+
 using namespace std::string_view_literals;
 
 // FIXME
@@ -544,3 +546,37 @@ TEST(ReadMatchingCodeUnit, NoMatchNonBorrowed)
 }
 
 #endif
+
+// read_exactly_n_width_units
+
+TEST(ReadExactlyNWidthUnits, AsciiContiguous)
+{
+    auto src = "abcdef"sv;
+    EXPECT_EQ(scn::impl::read_exactly_n_width_units(src, 4), src.begin() + 4);
+    EXPECT_EQ(scn::impl::read_exactly_n_width_units(src, 10), src.end());
+}
+TEST(ReadExactlyNWidthUnits, WideCodePointContiguous)
+{
+    auto src = "ab\U0001f600cd"sv;
+    EXPECT_EQ(scn::impl::read_exactly_n_width_units(src, 3), src.begin() + 2);
+    EXPECT_EQ(scn::impl::read_exactly_n_width_units(src, 4), src.begin() + 6);
+    EXPECT_EQ(scn::impl::read_exactly_n_width_units(src, 5), src.begin() + 7);
+}
+TEST(ReadExactlyNWidthUnits, LongAsciiRunContiguous)
+{
+    auto str = std::string(100, 'a') + "\xc3\xa4" + std::string(100, 'b');
+    auto src = std::string_view{str};
+    EXPECT_EQ(scn::impl::read_exactly_n_width_units(src, 50),
+              src.begin() + 50);
+    EXPECT_EQ(scn::impl::read_exactly_n_width_units(src, 101),
+              src.begin() + 102);
+    EXPECT_EQ(scn::impl::read_exactly_n_width_units(src, 150),
+              src.begin() + 151);
+}
+TEST(ReadExactlyNWidthUnits, NonContiguous)
+{
+    auto str = "ab\U0001f600cd"sv;
+    auto src = std::deque<char>(str.begin(), str.end());
+    EXPECT_EQ(scn::impl::read_exactly_n_width_units(src, 3), src.begin() + 2);
+    EXPECT_EQ(scn::impl::read_exactly_n_width_units(src, 4), src.begin() + 6);
+}
@@ -0,0 +1,107 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "../wrapped_gtest.h"
+
+#include <scn/util/small_vector.h>
+
+#include <string>
+
+using scn::detail::small_vector;
+
+TEST(SmallVectorTest, Inline)
+{
+    small_vector<int, 4> v{};
+    v.push_back(1);
+    v.push_back(2);
+    v.emplace_back(3);
+    EXPECT_EQ(v.capacity(), 4);
+    EXPECT_THAT(v, testing::ElementsAre(1, 2, 3));
+}
+
+TEST(SmallVectorTest, GrowToHeap)
+{
+    small_vector<std::string, 2> v{};
+    for (int i = 0; i < 10; ++i) {
+        v.push_back(std::to_string(i));
+    }
+    EXPECT_GE(v.capacity(), 10);
+    ASSERT_EQ(v.size(), 10);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(v[static_cast<size_t>(i)], std::to_string(i));
+    }
+}
+
+TEST(SmallVectorTest, PushBackOwnElementWhenFull)
+{
+    small_vector<std::string, 2> v{"foo", "bar"};
+    v.push_back(v[0]);
+    EXPECT_THAT(v, testing::ElementsAre("foo", "bar", "foo"));
+}
+
+TEST(SmallVectorTest, Resize)
+{
+    small_vector<int, 2> v(3, 42);
+    EXPECT_THAT(v, testing::ElementsAre(42, 42, 42));
+    v.resize(1);
+    EXPECT_THAT(v, testing::ElementsAre(42));
+    v.resize(2);
+    EXPECT_THAT(v, testing::ElementsAre(42, 0));
+}
+
+TEST(SmallVectorTest, Insert)
+{
+    small_vector<int, 4> v{1, 3};
+    v.insert(v.begin() + 1, 2);
+    v.emplace(v.begin(), 0);
+    v.insert(v.end(), 4);
+    EXPECT_THAT(v, testing::ElementsAre(0, 1, 2, 3, 4));
+}
+
+TEST(SmallVectorTest, CopyAndMove)
+{
+    for (std::size_t n : {1, 8}) {
+        small_vector<std::string, 2> v{};
+        for (std::size_t i = 0; i < n; ++i) {
+            v.push_back(std::string(i + 20, 'a'));
+        }
+
+        auto copy = v;
+        EXPECT_EQ(copy, v);
+
+        auto moved = std::move(copy);
+        EXPECT_EQ(moved, v);
+        EXPECT_TRUE(copy.empty());
+
+        copy = std::move(moved);
+        EXPECT_EQ(copy, v);
+        moved = copy;
+        EXPECT_EQ(moved, v);
+    }
+}
+
+TEST(SmallVectorTest, Swap)
+{
+    small_vector<std::string, 2> a{"a"};
+    small_vector<std::string, 2> b{"b", "c", "d"};
+    a.swap(b);
+    EXPECT_THAT(a, testing::ElementsAre("b", "c", "d"));
+    EXPECT_THAT(b, testing::ElementsAre("a"));
+    swap(a, b);
+    EXPECT_THAT(a, testing::ElementsAre("a"));
+    EXPECT_THAT(b, testing::ElementsAre("b", "c", "d"));
+}
@@ -233,13 +233,16 @@ TYPED_TEST(StringWordReaderTest, Word)
     EXPECT_TRUE(this->check_value(val, "foo"sv));
 }
 
-TEST(StringCharacterReaderTest, NonTakeWidthInput)
+TEST(StringCharacterReaderTest, WidthLimitedContiguousInput)
 {
+    // The field width is applied by the caller
     auto src = "foo"sv;
     std::string val{};
     auto ret = scn::impl::character_reader_impl<char>{}.read(src, val);
 
-    ASSERT_FALSE(ret);
+    ASSERT_TRUE(ret);
+    EXPECT_EQ(*ret, src.end());
+    EXPECT_EQ(val, "foo");
 }
 
 TEST(StringCharacterReaderTest, StringWithSameWidth)
@@ -419,3 +422,31 @@ TYPED_TEST(StringCharacterSetReaderTest, MultipleLiteralNonAsciiCharacters)
     EXPECT_NE(*ret, src.end());
     EXPECT_TRUE(this->check_value(val, "öä"));
 }
+
+#if !SCN_DISABLE_REGEX
+namespace {
+std::vector<std::string_view> get_regex_capture_names(std::string_view pattern)
+{
+    std::vector<std::string_view> names;
+    scn::impl::for_each_regex_capture_name(
+        pattern, [&](std::string_view name) { names.push_back(name); });
+    return names;
+}
+}  // namespace
+
+TEST(RegexCaptureNamesTest, NamedGroups)
+{
+    EXPECT_THAT(get_regex_capture_names("(?<a>x)(y)(?<bc>z)"),
+                testing::ElementsAre("a"sv, "bc"sv));
+}
+TEST(RegexCaptureNamesTest, Lookbehinds)
+{
+    EXPECT_THAT(get_regex_capture_names("(?<=x)(?<!y)(?<name>z)"),
+                testing::ElementsAre("name"sv));
+}
+TEST(RegexCaptureNamesTest, EscapedParenthesis)
+{
+    EXPECT_THAT(get_regex_capture_names("\\(?<a>x)\\\\(?<b>y)"),
+                testing::ElementsAre("b"sv));
+}
+#endif
@@ -37,6 +37,42 @@ TEST(CalculateTextWidthTest, EmojiWidth)
 {
     EXPECT_EQ(scn::impl::calculate_valid_text_width("😀"sv), 2);
 }
+TEST(CalculateTextWidthTest, MixedAsciiAndWideCodePoints)
+{
+    EXPECT_EQ(scn::impl::calculate_valid_text_width(
+                  "abc\U0001f600def\ud55c\uad6d"sv),
+              12);
+}
+TEST(CalculateTextWidthTest, LongAsciiRuns)
+{
+    auto str = std::string(100, 'a') + "\U0001f600" + std::string(50, 'b');
+    EXPECT_EQ(scn::impl::calculate_valid_text_width(std::string_view{str}),
+              152);
+    EXPECT_EQ(scn::impl::calculate_text_width(std::string_view{str}), 152);
+}
+TEST(CalculateTextWidthTest, InvalidEncoding)
+{
+    EXPECT_EQ(scn::impl::calculate_text_width("a\xff" "b"sv), 3);
+}
+TEST(CalculateTextWidthTest, WideString)
+{
+    EXPECT_EQ(scn::impl::calculate_valid_text_width(L"a\U0001f600b"sv), 4);
+}
+TEST(CalculateTextWidthTest, LookupTableMatchesRanges)
+{
+    for (char32_t cp = 0; cp <= 0x10ffff; ++cp) {
+        const bool is_wide = std::any_of(
+            scn::impl::fmt_v10_wide_ranges.begin(),
+            scn::impl::fmt_v10_wide_ranges.end(), [&](const auto& range) {
+                return cp >= range.first && cp <= range.last;
+            });
+        ASSERT_EQ(scn::impl::calculate_text_width_for_fmt_v10(cp),
+                  is_wide ? 2 : 1)
+            << std::hex << static_cast<uint32_t>(cp);
+    }
+    EXPECT_EQ(scn::impl::calculate_text_width_for_fmt_v10(0x303f), 1);
+    EXPECT_EQ(scn::impl::calculate_text_width_for_fmt_v10(0x3040), 2);
+}
 
 TEST(TakeWidthViewTest, TakeAllSimpleCodePoints)
 {
@@ -152,3 +188,13 @@ TEST(TakeWidthViewTest, BidirectionalComplexCodePoints)
     scn::ranges::advance(it, 3);
     EXPECT_EQ(it, v.end());
 }
+TEST(TakeWidthViewTest, WideCodePointNotFitting)
+{
+    auto v = scn::impl::take_width("ab\U0001f600cd"sv, 3);
+    EXPECT_THAT(v, testing::ElementsAre('a', 'b'));
+}
+TEST(TakeWidthViewTest, WideCodePointFitting)
+{
+    auto v = scn::impl::take_width("a\U0001f600cd"sv, 3);
+    EXPECT_EQ(scn::ranges::distance(v.begin(), v.end()), 5);
+}
@@ -96,3 +96,84 @@ TEST(TranscodeTest, Unicode)
 
     EXPECT_EQ(narrowed, in);
 }
+
+TEST(EncodingValidationCacheTest, ValidSource)
+{
+    std::string source{};
+    for (int i = 0; i < 100; ++i) {
+        source.append("\xc3\xa4\xc3\xb6 ");
+    }
+    auto sv = std::string_view{source};
+
+    auto cache = scn::impl::encoding_validation_cache<char>{sv};
+    for (std::size_t i = 0; i < sv.size(); i += 5) {
+        EXPECT_TRUE(cache.validate(sv.substr(i, 4)));
+    }
+}
+
+TEST(EncodingValidationCacheTest, InvalidCodeUnitAfterTokens)
+{
+    std::string source(300, 'a');
+    source[250] = '\xc3';
+    auto sv = std::string_view{source};
+
+    auto cache = scn::impl::encoding_validation_cache<char>{sv};
+    EXPECT_TRUE(cache.validate(sv.substr(0, 10)));
+    EXPECT_TRUE(cache.validate(sv.substr(20, 200)));
+    EXPECT_FALSE(cache.validate(sv.substr(240, 20)));
+    EXPECT_TRUE(cache.validate(sv.substr(260, 20)));
+}
+
+TEST(EncodingValidationCacheTest, TokenOutsideOfSource)
+{
+    auto cache = scn::impl::encoding_validation_cache<char>{"abc"sv};
+    EXPECT_TRUE(cache.validate("def"sv));
+    EXPECT_FALSE(cache.validate("\xc3"sv));
+}
+
+TEST(EncodingValidationCacheTest, DefaultConstructed)
+{
+    auto cache = scn::impl::encoding_validation_cache<char>{};
+    EXPECT_FALSE(cache.is_ascii("abc"sv));
+    EXPECT_TRUE(cache.validate("abc"sv));
+    EXPECT_FALSE(cache.validate("\xc3"sv));
+}
+
+TEST(EncodingValidationCacheTest, TokensAfterCachingStopped)
+{
+    std::string source(300, 'a');
+    source[100] = '\xc3';
+    auto sv = std::string_view{source};
+
+    auto cache = scn::impl::encoding_validation_cache<char>{sv};
+    EXPECT_FALSE(cache.validate(sv.substr(90, 20)));
+    // Tokens in the source, and elsewhere, are now validated separately
+    EXPECT_TRUE(cache.validate(sv.substr(200, 20)));
+    EXPECT_TRUE(cache.validate("def"sv));
+    EXPECT_FALSE(cache.validate("\xc3"sv));
+}
+
+TEST(EncodingValidationCacheTest, AssumeValid)
+{
+    auto cache = scn::impl::encoding_validation_cache<char>::assume_valid();
+    EXPECT_TRUE(cache.validate("\xc3"sv));
+}
+
+TEST(EncodingValidationCacheTest, AsciiHintedChecksLazily)
+{
+    std::string source(1000, 'a');
+    source[500] = '\xc3';
+    source[501] = '\xa4';
+    auto sv = std::string_view{source};
+
+    auto cache =
+        scn::impl::encoding_validation_cache<char>::ascii_hinted(sv, false);
+    // The non-ASCII code point is well outside of the first chunk
+    EXPECT_TRUE(cache.is_ascii(sv.substr(0, 10)));
+    EXPECT_TRUE(cache.is_ascii_hinted());
+    EXPECT_TRUE(cache.is_ascii(sv.substr(20, 100)));
+
+    EXPECT_FALSE(cache.is_ascii(sv.substr(490, 20)));
+    EXPECT_FALSE(cache.is_ascii_hinted());
+    EXPECT_TRUE(cache.validate(sv.substr(490, 20)));
+}
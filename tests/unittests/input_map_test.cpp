@@ -21,6 +21,7 @@
 #include <scn/util/span.h>
 
 #include <deque>
+#include <sstream>
 
 #if SCN_HAS_STD_SPAN
 #include <span>
@@ -124,3 +125,12 @@ TEST(InputMapTest, File)
     auto buf = scn::detail::make_scan_buffer(stdin);
     static_assert(std::is_same_v<decltype(buf), scn::detail::scan_file_buffer>);
 }
+
+TEST(InputMapTest, Istream)
+{
+    auto stream = std::istringstream{"foobar"};
+    auto buf = scn::detail::make_scan_buffer(stream);
+    static_assert(
+        std::is_same_v<decltype(buf), scn::detail::scan_istream_buffer>);
+    EXPECT_EQ(collect(buf.get()), "foobar");
+}
@@ -18,6 +18,7 @@
 #include "wrapped_gtest.h"
 
 #include <scn/detail/scan.h>
+#include <scn/xchar.h>
 
 namespace {
     template <typename... Args>
@@ -172,6 +173,27 @@ TEST(IntegerTest, LongInput)
     EXPECT_EQ(std::get<0>(result->values()), 1452555457);
 }
 
+TEST(IntegerTest, WideLongInput)
+{
+    auto result = scn::scan<long long, long long>(
+        L"1234567890123456789 -9876543210", L"{} {}");
+    ASSERT_TRUE(result);
+    auto [a, b] = result->values();
+    EXPECT_EQ(a, 1234567890123456789);
+    EXPECT_EQ(b, -9876543210);
+}
+TEST(IntegerTest, WideNonAsciiAfterDigits)
+{
+    // The low byte of U+0130 is '0', U+FF11 is FULLWIDTH DIGIT ONE
+    auto result = scn::scan<long long, long long>(
+        L"1234567\u0130 12345678\uff11", L"{}\u0130 {}");
+    ASSERT_TRUE(result);
+    auto [a, b] = result->values();
+    EXPECT_EQ(a, 1234567);
+    EXPECT_EQ(b, 12345678);
+    EXPECT_EQ(*result->begin(), L'\uff11');
+}
+
 TEST(IntegerTest, WonkyInputWithThsep)
 {
     std::string_view input = "-0x,)27614,)24t14741";
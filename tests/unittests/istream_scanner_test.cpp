@@ -20,7 +20,9 @@
 
 #include "wrapped_gtest.h"
 
+#include <deque>
 #include <istream>
+#include <string>
 
 struct has_istream_operator {
     int i{};
@@ -34,6 +36,16 @@ template <typename CharT>
 struct scn::scanner<has_istream_operator, CharT>
     : public scn::basic_istream_scanner<CharT> {};
 
+struct has_istream_operator_with_contiguous_context
+    : has_istream_operator {};
+template <typename CharT>
+struct scn::scanner<has_istream_operator_with_contiguous_context, CharT>
+    : public scn::basic_istream_scanner<CharT> {};
+template <>
+struct scn::scanner_supports_contiguous_context<
+    has_istream_operator_with_contiguous_context,
+    char> : std::true_type {};
+
 TEST(IstreamScannerTest, HasIstreamOperator)
 {
     auto result = scn::scan<has_istream_operator>("42", "{}");
@@ -51,3 +63,103 @@ TEST(IstreamScannerTest, OtherValues)
     EXPECT_EQ(b.i, 456);
     EXPECT_EQ(c.i, 789);
 }
+
+struct has_istream_operator_with_putback {
+    char first{}, second{};
+
+    // Reads the next two characters, and puts them back
+    friend std::istream& operator>>(std::istream& is,
+                                    has_istream_operator_with_putback& val)
+    {
+        if (is.get(val.first) && is.get(val.second)) {
+            is.unget();
+            is.unget();
+        }
+        return is;
+    }
+};
+template <typename CharT>
+struct scn::scanner<has_istream_operator_with_putback, CharT>
+    : public scn::basic_istream_scanner<CharT> {};
+
+TEST(IstreamScannerTest, ContiguousContext)
+{
+    auto input = std::string_view{"123 456 789"};
+    auto result = scn::scan<has_istream_operator_with_contiguous_context,
+                            has_istream_operator_with_contiguous_context>(
+        input, "{} {}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->begin(), input.begin() + 7);
+    const auto& [a, b] = result->values();
+    EXPECT_EQ(a.i, 123);
+    EXPECT_EQ(b.i, 456);
+}
+
+TEST(IstreamScannerTest, NonContiguousSource)
+{
+    auto input = std::deque<char>{'1', '2', '3', ' ', '4', '5', '6'};
+    auto result = scn::scan<has_istream_operator, has_istream_operator>(
+        input, "{} {}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->begin(), input.end());
+    const auto& [a, b] = result->values();
+    EXPECT_EQ(a.i, 123);
+    EXPECT_EQ(b.i, 456);
+}
+
+TEST(IstreamScannerTest, PutbackWithNonContiguousSource)
+{
+    auto input = std::deque<char>{'a', 'b'};
+    auto result = scn::scan<has_istream_operator_with_putback, char, char>(
+        input, "{}{}{}");
+    ASSERT_TRUE(result);
+    const auto& [val, a, b] = result->values();
+    EXPECT_EQ(val.first, 'a');
+    EXPECT_EQ(val.second, 'b');
+    EXPECT_EQ(a, 'a');
+    EXPECT_EQ(b, 'b');
+}
+
+struct has_istream_operator_with_long_putback {
+    std::string chars{};
+
+    // Reads the next three characters, and puts them all back
+    friend std::istream& operator>>(std::istream& is,
+                                    has_istream_operator_with_long_putback& val)
+    {
+        char ch{};
+        for (int i = 0; i < 3 && is.get(ch); ++i) {
+            val.chars.push_back(ch);
+        }
+        for (std::size_t i = 0; i < val.chars.size(); ++i) {
+            is.unget();
+        }
+        return is;
+    }
+};
+template <typename CharT>
+struct scn::scanner<has_istream_operator_with_long_putback, CharT>
+    : public scn::basic_istream_scanner<CharT> {};
+
+TEST(IstreamScannerTest, PutbackAcrossSegmentsWithNonContiguousSource)
+{
+    // A non-contiguous source is buffered one character at a time,
+    // so every unget() has to step back into the previous segment
+    auto str = std::string(100, 'x') + " abc";
+    auto input = std::deque<char>(str.begin(), str.end());
+    auto result = scn::scan<std::string, has_istream_operator_with_long_putback,
+                            std::string>(input, "{} {}{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->begin(), input.end());
+    const auto& [prefix, val, rest] = result->values();
+    EXPECT_EQ(prefix, std::string(100, 'x'));
+    EXPECT_EQ(val.chars, "abc");
+    EXPECT_EQ(rest, "abc");
+}
+
+TEST(IstreamScannerTest, InvalidValue)
+{
+    auto result = scn::scan<has_istream_operator>("abc", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
@@ -17,8 +17,11 @@
 
 #include "wrapped_gtest.h"
 
+#include <array>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <scn/detail/scan.h>
@@ -34,6 +37,112 @@ TEST(RangesTest, VectorSequence)
     EXPECT_THAT(result->value(), testing::ElementsAre(123, 456));
 }
 
+TEST(RangesTest, VectorOfDoubles)
+{
+    auto result = scn::scan<std::vector<double>>("[1.5,-2, 3e2 ]", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->value(), testing::ElementsAre(1.5, -2.0, 300.0));
+}
+
+TEST(RangesTest, EmptyVector)
+{
+    auto result = scn::scan<std::vector<int>>("[ ]", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result->value().empty());
+}
+
+TEST(RangesTest, VectorLongerThanChunk)
+{
+    std::string source{"["};
+    std::vector<int> expected{};
+    for (int i = 0; i < 1000; ++i) {
+        if (i != 0) {
+            source.append(", ");
+        }
+        source.append(std::to_string(i * 31 - 500));
+        expected.push_back(i * 31 - 500);
+    }
+    source.append("] rest");
+
+    auto result = scn::scan<std::vector<int>>(source, "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), expected);
+    EXPECT_EQ(std::string(result->begin(), result->end()), " rest");
+}
+
+TEST(RangesTest, VectorWithMissingSeparator)
+{
+    auto result = scn::scan<std::vector<int>>("[12 34]", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
+TEST(RangesTest, VectorWithInvalidElement)
+{
+    auto result = scn::scan<std::vector<int>>("[12, abc]", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
+TEST(RangesTest, VectorWithoutClosingBracket)
+{
+    auto result = scn::scan<std::vector<int>>("[12, 34", "{}");
+    ASSERT_FALSE(result);
+}
+
+TEST(RangesTest, SpanIsShrunkToScannedElements)
+{
+    std::array<int, 8> storage{};
+    auto result =
+        scn::scan("[1, 2, 3]", "{}", std::tuple{scn::span<int>{storage}});
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().data(), storage.data());
+    EXPECT_THAT(result->value(), testing::ElementsAre(1, 2, 3));
+    EXPECT_THAT(storage, testing::ElementsAre(1, 2, 3, 0, 0, 0, 0, 0));
+}
+
+TEST(RangesTest, SpanOverCArray)
+{
+    double storage[4]{};
+    auto result =
+        scn::scan("[1.5, 2.5]", "{}", std::tuple{scn::span{storage}});
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().size(), 2);
+    EXPECT_EQ(storage[0], 1.5);
+    EXPECT_EQ(storage[1], 2.5);
+}
+
+TEST(RangesTest, SpanOfChars)
+{
+    char storage[4]{};
+    auto result = scn::scan("[a,b,c]", "{}", std::tuple{scn::span{storage}});
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->value(), testing::ElementsAre('a', 'b', 'c'));
+}
+
+TEST(RangesTest, SpanCapacityExceeded)
+{
+    std::array<int, 2> storage{};
+    auto result =
+        scn::scan("[1, 2, 3]", "{}", std::tuple{scn::span<int>{storage}});
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
+TEST(RangesTest, StdArray)
+{
+    auto result = scn::scan<std::array<int, 3>>("[4, 5, 6]", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->value(), testing::ElementsAre(4, 5, 6));
+}
+
+TEST(RangesTest, StdArrayWithTooFewElements)
+{
+    auto result = scn::scan<std::array<int, 3>>("[4, 5]", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
 TEST(RangesTest, Set)
 {
     static_assert(scn::range_format_kind<std::set<int>, char>::value ==
@@ -54,3 +163,74 @@ TEST(RangesTest, Map)
     EXPECT_THAT(result->value(),
                 testing::ElementsAre(std::pair{12, 34}, std::pair{56, 78}));
 }
+
+TEST(RangesTest, MapWithUnsortedInput)
+{
+    auto result =
+        scn::scan<std::map<int, int>>("{56: 78, 12: 34, 90: 12}", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->value(),
+                testing::ElementsAre(std::pair{12, 34}, std::pair{56, 78},
+                                     std::pair{90, 12}));
+}
+
+TEST(RangesTest, MapWithStringKeys)
+{
+    auto result =
+        scn::scan<std::map<std::string, int>>("{abc : 1, def : 2}", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->value(),
+                testing::ElementsAre(std::pair{std::string{"abc"}, 1},
+                                     std::pair{std::string{"def"}, 2}));
+}
+
+TEST(RangesTest, MapWithDuplicateKeysKeepsFirst)
+{
+    auto result = scn::scan<std::map<int, int>>("{1: 2, 1: 3}", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->value(), testing::ElementsAre(std::pair{1, 2}));
+}
+
+TEST(RangesTest, UnorderedMap)
+{
+    static_assert(
+        scn::range_format_kind<std::unordered_map<int, int>, char>::value ==
+        scn::range_format::map);
+
+    std::string source{"{"};
+    for (int i = 0; i < 1000; ++i) {
+        if (i != 0) {
+            source.append(", ");
+        }
+        source.append(std::to_string(i) + ": " + std::to_string(i * 2));
+    }
+    source.push_back('}');
+
+    auto result = scn::scan<std::unordered_map<int, int>>(source, "{}");
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result->value().size(), 1000);
+    EXPECT_EQ(result->value().at(123), 246);
+}
+
+TEST(RangesTest, UnorderedSet)
+{
+    auto result = scn::scan<std::unordered_set<int>>("{3, 1, 2, 1}", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->value(), testing::UnorderedElementsAre(1, 2, 3));
+}
+
+TEST(RangesTest, VectorOfPairs)
+{
+    auto result =
+        scn::scan<std::vector<std::pair<int, int>>>("[(1, 2), (3, 4)]", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_THAT(result->value(),
+                testing::ElementsAre(std::pair{1, 2}, std::pair{3, 4}));
+
+    // The separators inside the pairs aren't counted as elements,
+    // so nothing is reserved up front
+    std::vector<std::pair<int, int>> pushed{};
+    pushed.push_back({1, 2});
+    pushed.push_back({3, 4});
+    EXPECT_EQ(result->value().capacity(), pushed.capacity());
+}
@@ -21,6 +21,9 @@
 #include <scn/detail/scan.h>
 #include <scn/detail/xchar.h>
 
+#include <deque>
+#include <istream>
+
 using namespace std::string_view_literals;
 
 #if !SCN_DISABLE_REGEX
@@ -107,6 +110,84 @@ TEST(RegexTest, NamedMatches)
     EXPECT_EQ(r->value()[2]->get(), "123");
     EXPECT_FALSE(r->value()[2]->name());
 }
+
+TEST(RegexTest, NamedMatchesNameOutlivesRuntimeFormatString)
+{
+    auto r = scn::scan<scn::regex_matches>(
+        "foobar123",
+        scn::runtime_format(std::string{"{:/(?<prefix>[a-z]+)([0-9]+)/}"}));
+    ASSERT_TRUE(r);
+    ASSERT_TRUE(r->value()[1]);
+    ASSERT_TRUE(r->value()[1]->name());
+    EXPECT_EQ(*r->value()[1]->name(), "prefix");
+}
+
+TEST(RegexTest, NamedMatchesWithSameMatchedText)
+{
+    // Names are attached by group index, not by the text they matched
+    auto r = scn::scan<scn::regex_matches>("abab",
+                                           "{:/(ab)(?<second>ab)/}");
+    ASSERT_TRUE(r);
+    ASSERT_EQ(r->value().size(), 3);
+    ASSERT_TRUE(r->value()[1]);
+    EXPECT_FALSE(r->value()[1]->name());
+    ASSERT_TRUE(r->value()[2]);
+    ASSERT_TRUE(r->value()[2]->name());
+    EXPECT_EQ(*r->value()[2]->name(), "second");
+}
+
+TEST(RegexTest, NamedMatchesWithNestedAndUnmatchedGroups)
+{
+    auto r = scn::scan<scn::regex_matches>(
+        "key=42", "{:/(?<key>[a-z]+)=(?<value>(?<digits>[0-9]+)|(?<word>x))/}");
+    ASSERT_TRUE(r);
+    ASSERT_EQ(r->value().size(), 5);
+
+    ASSERT_TRUE(r->value()[1]);
+    EXPECT_EQ(r->value()[1]->get(), "key");
+    EXPECT_EQ(r->value()[1]->name(), "key");
+    ASSERT_TRUE(r->value()[2]);
+    EXPECT_EQ(r->value()[2]->get(), "42");
+    EXPECT_EQ(r->value()[2]->name(), "value");
+    ASSERT_TRUE(r->value()[3]);
+    EXPECT_EQ(r->value()[3]->get(), "42");
+    EXPECT_EQ(r->value()[3]->name(), "digits");
+    EXPECT_FALSE(r->value()[4]);
+}
+
+#if SCN_REGEX_BACKEND == SCN_REGEX_BACKEND_BOOST
+// re2 doesn't support lookbehinds
+TEST(RegexTest, NamedMatchesAfterLookbehind)
+{
+    auto r = scn::scan<scn::regex_matches>("abc",
+                                           "{:/(?<![0-9])(?<word>[a-z]+)/}");
+    ASSERT_TRUE(r);
+    ASSERT_EQ(r->value().size(), 2);
+    ASSERT_TRUE(r->value()[1]);
+    EXPECT_EQ(r->value()[1]->get(), "abc");
+    EXPECT_EQ(r->value()[1]->name(), "word");
+}
+#endif
+
+TEST(RegexTest, NamedMatchesWithEscapedSlash)
+{
+    constexpr std::string_view format =
+        "{:/(?<dir>[a-z]+)\\/(?<file>[a-z]+)/}";
+    auto r = scn::scan<scn::regex_matches>("foo/bar",
+                                           scn::runtime_format(format));
+    ASSERT_TRUE(r);
+    ASSERT_EQ(r->value().size(), 3);
+
+    ASSERT_TRUE(r->value()[1]);
+    EXPECT_EQ(r->value()[1]->get(), "foo");
+    ASSERT_TRUE(r->value()[1]->name());
+    EXPECT_EQ(*r->value()[1]->name(), "dir");
+
+    ASSERT_TRUE(r->value()[2]);
+    EXPECT_EQ(r->value()[2]->get(), "bar");
+    ASSERT_TRUE(r->value()[2]->name());
+    EXPECT_EQ(*r->value()[2]->name(), "file");
+}
 #endif
 
 #if SCN_REGEX_SUPPORTS_WIDE_STRINGS
@@ -276,4 +357,153 @@ TEST(RegexTest, EscapedSlashInPattern) {
     EXPECT_THAT(r->value(), "foo/bar");
 }
 
+TEST(RegexTest, MoreMatchesThanInlineCapacity)
+{
+    auto r = scn::scan<scn::regex_matches>(
+        "abcdefghij", "{:/(a)(b)(c)(d)(e)(f)(g)(h)(i)(j)/}");
+    ASSERT_TRUE(r);
+    EXPECT_TRUE(r->range().empty());
+    ASSERT_EQ(r->value().size(), 11);
+    EXPECT_GT(r->value().size(), scn::regex_matches::inline_capacity);
+
+    EXPECT_EQ(r->value()[0]->get(), "abcdefghij");
+    for (std::size_t i = 1; i < r->value().size(); ++i) {
+        ASSERT_TRUE(r->value()[i]);
+        EXPECT_EQ(r->value()[i]->get(),
+                  std::string(1, static_cast<char>('a' + i - 1)));
+    }
+}
+
+#if SCN_REGEX_SUPPORTS_NON_CONTIGUOUS_SOURCES
+TEST(RegexTest, StringFromNonContiguousSource)
+{
+    auto source = std::deque<char>{'f', 'o', 'o', '1', '2', '3'};
+    auto r = scn::scan<std::string, int>(source, "{:/[a-z]+/}{}");
+    ASSERT_TRUE(r);
+    EXPECT_EQ(r->begin(), source.end());
+    auto [str, i] = r->values();
+    EXPECT_EQ(str, "foo");
+    EXPECT_EQ(i, 123);
+}
+
+TEST(RegexTest, LongStringFromNonContiguousSource)
+{
+    auto input = std::string(1000, 'a') + "!";
+    auto source = std::deque<char>(input.begin(), input.end());
+    auto r = scn::scan<std::string>(source, "{:/a+/}");
+    ASSERT_TRUE(r);
+    EXPECT_EQ(r->value(), std::string(1000, 'a'));
+    EXPECT_EQ(r->begin(), source.end() - 1);
+}
+
+TEST(RegexTest, NoMatchFromNonContiguousSource)
+{
+    auto source = std::deque<char>{'1', '2', '3'};
+    auto r = scn::scan<std::string>(source, "{:/[a-z]+/}");
+    ASSERT_FALSE(r);
+    EXPECT_EQ(r.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
+TEST(RegexTest, NonContiguousSourceMatchesLikeContiguous)
+{
+    // The regex engine has to look past the first 64 characters
+    // to tell whether the lookahead, the word boundary,
+    // or the longer alternative matches
+    const auto input = std::string(62, 'a') + "xyz";
+    const auto source = std::deque<char>(input.begin(), input.end());
+    for (auto pattern : {"a{62}x(?!yz)"sv, "a{62}x(?=yz)"sv,
+                         "a{62}(?:xyz|x)"sv, "a{62}xy\\b"sv}) {
+        SCOPED_TRACE(pattern);
+        const auto format = "{:/" + std::string{pattern} + "/}";
+        auto contiguous =
+            scn::scan<std::string>(input, scn::runtime_format(format));
+        auto non_contiguous =
+            scn::scan<std::string>(source, scn::runtime_format(format));
+        ASSERT_EQ(contiguous.has_value(), non_contiguous.has_value());
+        if (contiguous) {
+            EXPECT_EQ(contiguous->value(), non_contiguous->value());
+            EXPECT_EQ(contiguous->begin() - input.begin(),
+                      non_contiguous->begin() - source.begin());
+        }
+    }
+}
+
+namespace {
+// Never runs out: a regex reading until the end of the source never returns
+class endless_streambuf : public std::streambuf {
+private:
+    int_type underflow() override
+    {
+        return traits_type::to_int_type('a');
+    }
+    int_type uflow() override
+    {
+        return traits_type::to_int_type('a');
+    }
+};
+}  // namespace
+
+TEST(RegexTest, NonContiguousSourceIsOnlyReadAsFarAsNeeded)
+{
+    auto streambuf = endless_streambuf{};
+    auto source = std::istream{&streambuf};
+
+    auto no_match = scn::scan<std::string>(source, "{:/[0-9]+/}");
+    ASSERT_FALSE(no_match);
+    EXPECT_EQ(no_match.error().code(), scn::scan_error::invalid_scanned_value);
+
+    auto match = scn::scan<std::string>(source, "{:/a{100}(?!b)/}");
+    ASSERT_TRUE(match);
+    EXPECT_EQ(match->value(), std::string(100, 'a'));
+}
+#else
+TEST(RegexTest, StringFromNonContiguousSource)
+{
+    auto source = std::deque<char>{'f', 'o', 'o', '1', '2', '3'};
+    auto r = scn::scan<std::string>(
+        source, scn::runtime_format(std::string{"{:/[a-z]+/}"}));
+    ASSERT_FALSE(r);
+    EXPECT_EQ(r.error().code(), scn::scan_error::invalid_scanned_value);
+}
+#endif
+
+TEST(RegexTest, SamePatternWithDifferentFlags)
+{
+    auto r = scn::scan<std::string_view>("FooBar123", "{:/[a-z]+/}");
+    EXPECT_FALSE(r);
+
+    r = scn::scan<std::string_view>("FooBar123", "{:/[a-z]+/i}");
+    ASSERT_TRUE(r);
+    EXPECT_EQ(r->value(), "FooBar");
+
+    r = scn::scan<std::string_view>("fooBar123", "{:/[a-z]+/}");
+    ASSERT_TRUE(r);
+    EXPECT_EQ(r->value(), "foo");
+}
+
+TEST(RegexTest, SamePatternForStringAndMatches)
+{
+    auto str = scn::scan<std::string_view>("foo123", "{:/([a-z]+)/}");
+    ASSERT_TRUE(str);
+    EXPECT_EQ(str->value(), "foo");
+
+    auto matches = scn::scan<scn::regex_matches>("foo123", "{:/([a-z]+)/}");
+    ASSERT_TRUE(matches);
+    EXPECT_EQ(matches->value().size(), 2);
+}
+
+TEST(RegexTest, MorePatternsThanFitInCache)
+{
+    for (int round = 0; round < 2; ++round) {
+        for (int i = 0; i < 2 * SCN_REGEX_CACHE_SIZE + 1; ++i) {
+            const auto pattern = "{:/x{" + std::to_string(i + 1) + "}/}";
+            const auto input = std::string(static_cast<size_t>(i + 1), 'x');
+            auto r = scn::scan<std::string_view>(input,
+                                                 scn::runtime_format(pattern));
+            ASSERT_TRUE(r) << pattern;
+            EXPECT_EQ(r->value(), input);
+        }
+    }
+}
+
 #endif // !SCN_DISABLE_REGEX
@@ -20,6 +20,8 @@
 #include <scn/detail/result.h>
 #include <scn/detail/scan.h>
 
+#include <sstream>
+
 using ::testing::Test;
 
 template <bool, typename>
@@ -103,3 +105,93 @@ TEST(SourceTest, SourceIsStringRvalue)
         std::is_same_v<decltype(result),
                        scan_result_helper<scn::ranges::dangling, int, double>>);
 }
+
+TEST(SourceTest, SourceIsIstream)
+{
+    auto source = std::istringstream{"123 3.14 rest"};
+    auto result = scn::scan<int, double>(source, "{} {}");
+    static_assert(
+        std::is_same_v<decltype(result),
+                       scn::scan_expected<
+                           scn::scan_result<std::istream*, int, double>>>);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(&result->stream(), &source);
+    auto [i, d] = result->values();
+    EXPECT_EQ(i, 123);
+    EXPECT_DOUBLE_EQ(d, 3.14);
+
+    std::string rest{};
+    std::getline(source, rest);
+    EXPECT_EQ(rest, " rest");
+}
+
+TEST(SourceTest, SourceIsIstreamInLoop)
+{
+    auto source = std::istringstream{"1 2 3 x"};
+    int sum = 0;
+    while (auto result = scn::scan<int>(source, "{}")) {
+        sum += result->value();
+    }
+    EXPECT_EQ(sum, 6);
+
+    // Failed scan leaves the input in the stream
+    std::string rest{};
+    source >> rest;
+    EXPECT_EQ(rest, "x");
+}
+
+namespace {
+// Has no get area, every character goes through underflow/uflow
+class unbuffered_streambuf : public std::streambuf {
+public:
+    explicit unbuffered_streambuf(std::string_view str) : m_str(str) {}
+
+private:
+    int_type underflow() override
+    {
+        if (m_pos == m_str.size()) {
+            return traits_type::eof();
+        }
+        return traits_type::to_int_type(m_str[m_pos]);
+    }
+
+    int_type uflow() override
+    {
+        auto ch = underflow();
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            ++m_pos;
+        }
+        return ch;
+    }
+
+    int_type pbackfail(int_type ch) override
+    {
+        if (m_pos == 0) {
+            return traits_type::eof();
+        }
+        --m_pos;
+        return traits_type::not_eof(ch);
+    }
+
+    std::string_view m_str;
+    std::size_t m_pos{0};
+};
+}  // namespace
+
+TEST(SourceTest, SourceIsIstreamWithUnbufferedStreambuf)
+{
+    auto streambuf = unbuffered_streambuf{"123 456 abc"};
+    auto source = std::istream{&streambuf};
+
+    auto result = scn::scan<int, int>(source, "{} {}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::get<0>(result->values()), 123);
+    EXPECT_EQ(std::get<1>(result->values()), 456);
+
+    auto failed = scn::scan<int>(source, "{}");
+    EXPECT_FALSE(failed);
+
+    std::string rest{};
+    std::getline(source, rest);
+    EXPECT_EQ(rest, " abc");
+}
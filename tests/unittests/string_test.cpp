@@ -18,6 +18,11 @@
 #include <scn/scan.h>
 #include <scn/xchar.h>
 
+#include <deque>
+#if SCN_HAS_INCLUDE(<memory_resource>)
+#include <memory_resource>
+#endif
+
 #include "wrapped_gtest.h"
 
 TEST(StringTest, DefaultNarrowStringFromNarrowSource)
@@ -116,6 +121,41 @@ TEST(StringTest, CharacterPresentationWideStringFromNarrowSource)
     EXPECT_STREQ(result->begin(), "def");
     EXPECT_EQ(result->value(), L"abc ");
 }
+TEST(StringTest, CharacterPresentationWithWideCodePointNotFitting)
+{
+    auto result = scn::scan<std::string>("ab\U0001f600cd", "{:3c}");
+    ASSERT_TRUE(result);
+    EXPECT_STREQ(result->begin(), "\U0001f600cd");
+    EXPECT_EQ(result->value(), "ab");
+}
+TEST(StringTest, CharacterPresentationWithWideCodePointNotFittingNonContiguous)
+{
+    auto source = std::deque<char>{'a', 'b', '\xf0', '\x9f', '\x98', '\x80'};
+    auto result = scn::scan<std::string>(source, "{:3c}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->begin(), source.begin() + 2);
+    EXPECT_EQ(result->value(), "ab");
+}
+TEST(StringTest, WidthLimitedWord)
+{
+    auto result = scn::scan<std::string, std::string>("abcdef ghi", "{:4}{}");
+    ASSERT_TRUE(result);
+    auto [a, b] = result->values();
+    EXPECT_EQ(a, "abcd");
+    EXPECT_EQ(b, "ef");
+}
+TEST(StringTest, WideStringsFromNonContiguousNarrowSource)
+{
+    auto source =
+        std::deque<char>{'a', 'b', 'c', ' ', '\xc3', '\xa4', 'x', ' ', 'd'};
+    auto result = scn::scan<std::wstring, std::wstring, std::wstring>(
+        source, "{} {:1c}{:[a-z]}");
+    ASSERT_TRUE(result);
+    auto [a, b, c] = result->values();
+    EXPECT_EQ(a, L"abc");
+    EXPECT_EQ(b, L"\u00e4");
+    EXPECT_EQ(c, L"x");
+}
 
 TEST(StringTest, CharacterSetPresentationNarrowStringFromNarrowSource)
 {
@@ -219,3 +259,179 @@ TEST(StringTest, RecoveryFromInvalidEncoding)
     EXPECT_EQ(result->begin(), source.end() - 1);
 #endif
 }
+
+TEST(StringTest, AssumeValidUtf8)
+{
+    auto result = scn::scan<std::string, std::string>(
+        scn::assume_valid_utf8, "abc äö def", "{} {}");
+    ASSERT_TRUE(result);
+    EXPECT_STREQ(result->begin(), " def");
+    auto [a, b] = result->values();
+    EXPECT_EQ(a, "abc");
+    EXPECT_EQ(b, "äö");
+}
+TEST(StringTest, AssumeValidUtf8WideStringFromNarrowSource)
+{
+    auto result = scn::scan<std::wstring>(scn::assume_valid_utf8,
+                                          "ä\U0001f600 def", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_STREQ(result->begin(), " def");
+    EXPECT_EQ(result->value(), L"ä\U0001f600");
+}
+TEST(StringTest, AssumeValidUtf8FromNonContiguousSource)
+{
+    auto source = std::deque<char>{'a', 'b', 'c', ' ', 'd'};
+    auto result = scn::scan<std::string>(scn::assume_valid_utf8, source,
+                                         "{:[a-z]}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), "abc");
+    EXPECT_EQ(result->begin(), source.begin() + 3);
+}
+
+TEST(StringTest, AsciiSource)
+{
+    auto result = scn::scan<std::string_view, std::wstring, std::string>(
+        scn::ascii_source, "GET /index.html HTTP/1.1", "{} {} {:[^\xc3\xa4/]}");
+    ASSERT_TRUE(result);
+    EXPECT_STREQ(result->begin(), "/1.1");
+    auto [a, b, c] = result->values();
+    EXPECT_EQ(a, "GET");
+    EXPECT_EQ(b, L"/index.html");
+    EXPECT_EQ(c, "HTTP");
+}
+TEST(StringTest, AsciiSourceWithNonAsciiContents)
+{
+    auto result = scn::scan<std::string, std::string>(
+        scn::ascii_source, "abc \xc3\xa4\xc3\xb6/ def", "{} {:[^\xc3\xb6]}");
+    ASSERT_TRUE(result);
+    EXPECT_STREQ(result->begin(), "\xc3\xb6/ def");
+    auto [a, b] = result->values();
+    EXPECT_EQ(a, "abc");
+    EXPECT_EQ(b, "\xc3\xa4");
+}
+TEST(StringTest, AsciiSourceWithInvalidEncoding)
+{
+    auto result =
+        scn::scan<std::string>(scn::ascii_source, "abc\xff def", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
+TEST(StringTest, CharacterSetWithOverlappingNonAsciiRanges)
+{
+    auto result = scn::scan<std::string>(
+        "abc\xc3\xa0\xc3\xb6xyz\xc3\xa9\xc3\xb8 def",
+        "{:[a-z\xc3\xa4-\xc3\xb6\xc3\xa0-\xc3\xa5]}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), "abc\xc3\xa0\xc3\xb6xyz\xc3\xa9");
+    EXPECT_STREQ(result->begin(), "\xc3\xb8 def");
+}
+
+TEST(StringTest, MultipleCharacterSetsWithNonAsciiRanges)
+{
+    // Each field compiles its own set of non-ASCII ranges
+    auto result = scn::scan<std::string, std::string>(
+        "\xc3\xa4\xc3\xb6 \xc3\xa9\xc3\xa8\xc3\xa4",
+        "{:[\xc3\xa4\xc3\xb6]} {:[\xc3\xa8-\xc3\xa9]}");
+    ASSERT_TRUE(result);
+    auto [a, b] = result->values();
+    EXPECT_EQ(a, "\xc3\xa4\xc3\xb6");
+    EXPECT_EQ(b, "\xc3\xa9\xc3\xa8");
+    EXPECT_STREQ(result->begin(), "\xc3\xa4");
+}
+
+namespace {
+int counting_allocator_allocations = 0;
+
+template <typename T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+    explicit counting_allocator(int* c) : counter(c) {}
+    template <typename U>
+    counting_allocator(const counting_allocator<U>& other)
+        : counter(other.counter)
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        ++*counter;
+        return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T* p, std::size_t n)
+    {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(const counting_allocator<U>& other) const
+    {
+        return counter == other.counter;
+    }
+    template <typename U>
+    bool operator!=(const counting_allocator<U>& other) const
+    {
+        return counter != other.counter;
+    }
+
+    int* counter{&counting_allocator_allocations};
+};
+
+using counted_string =
+    std::basic_string<char, std::char_traits<char>, counting_allocator<char>>;
+using counted_wstring = std::basic_string<wchar_t,
+                                          std::char_traits<wchar_t>,
+                                          counting_allocator<wchar_t>>;
+}  // namespace
+
+TEST(StringTest, StringWithCustomAllocator)
+{
+    int allocations = 0;
+    const auto alloc = counting_allocator<char>{&allocations};
+    auto result = scn::scan<counted_string, counted_string>(
+        "abcdefghijklmnopqrstuvwxyz0123456789 abc", "{} {:[a-c]}",
+        std::tuple{counted_string{alloc}, counted_string{alloc}});
+    ASSERT_TRUE(result);
+    const auto& [a, b] = result->values();
+    EXPECT_EQ(a, "abcdefghijklmnopqrstuvwxyz0123456789");
+    EXPECT_EQ(b, "abc");
+    // The values are scanned into, keeping their allocator.
+    // Only the first one doesn't fit in SSO.
+    EXPECT_EQ(a.get_allocator(), alloc);
+    EXPECT_EQ(b.get_allocator(), alloc);
+    EXPECT_EQ(allocations, 1);
+}
+TEST(StringTest, StringWithCustomAllocatorFromNonContiguousSource)
+{
+    auto source = std::deque<char>{'a', 'b', 'c', ' ', 'd'};
+    auto result = scn::scan<counted_string>(source, "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), "abc");
+    EXPECT_EQ(result->begin(), source.begin() + 3);
+}
+TEST(StringTest, WideStringWithCustomAllocatorFromNarrowSource)
+{
+    auto result = scn::scan<counted_wstring>("\xc3\xa4" "bc def", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), L"\u00e4bc");
+}
+
+#if SCN_HAS_INCLUDE(<memory_resource>) && defined(__cpp_lib_memory_resource)
+TEST(StringTest, PmrStringWithMonotonicBuffer)
+{
+    char buffer[256]{};
+    std::pmr::monotonic_buffer_resource arena{buffer, sizeof(buffer),
+                                              std::pmr::null_memory_resource()};
+
+    auto result = scn::scan<std::pmr::string>(
+        "a_rather_long_string_that_does_not_fit_in_sso rest", "{}",
+        std::tuple{std::pmr::string{&arena}});
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), "a_rather_long_string_that_does_not_fit_in_sso");
+    EXPECT_EQ(result->value().get_allocator().resource(), &arena);
+    EXPECT_GE(result->value().data(), buffer);
+    EXPECT_LT(result->value().data(), buffer + sizeof(buffer));
+}
+#endif
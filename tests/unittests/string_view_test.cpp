@@ -130,3 +130,13 @@ TEST(StringViewTest, WonkyInput2)
     EXPECT_EQ(result->value(), input);
 #endif
 }
+
+TEST(StringViewTest, AssumeValidUtf8)
+{
+    auto source = std::string_view{"äbc def"};
+    auto result =
+        scn::scan<std::string_view>(scn::assume_valid_utf8, source, "{:4c}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), "äbc ");
+    EXPECT_EQ(result->begin(), source.begin() + 5);
+}